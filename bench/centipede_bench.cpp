@@ -0,0 +1,694 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Times the simulation kernels at the stock entity
+ * counts and at 1k, 10k and 100k entities: mushroom box queries, centipede
+ * head update plus body placement on the path, laser update and collision,
+ * spider movement and mushroom eating, broadphase pairs of lasers against
+ * segments, one box against a packed batch with the vector kernel and one
+ * box at a time, and mushroom field generation. Bigger counts get a bigger
+ * field with the stock mushroom density. Each kernel runs a few
+ * repetitions from the same starting state and the fastest one is kept.
+ *
+ * Results are written as JSON. With --compare the run is checked against a
+ * stored result file and any kernel slower than the threshold is reported,
+ * the exit code is 2 when something regressed.
+ *
+ * usage: centipede_bench [--out FILE] [--compare FILE] [--threshold PERCENT]
+ *                        [--reps N] [--max-count N]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BoxBatch.h"
+#include "Broadphase.h"
+#include "ECE_Centipede.h"
+#include "GameRandom.h"
+#include "GameTypes.h"
+#include "LaserPool.h"
+#include "MushroomField.h"
+#include "SegmentPool.h"
+
+// same sizes and speeds as WorldConfig
+static const Vec2 MUSHROOM_SIZE(27, 26);
+static const Vec2 HEAD_SIZE(24, 27);
+static const Vec2 BODY_SIZE(22, 24);
+static const Vec2 LASER_SIZE(2, 15);
+static const Vec2 SPIDER_SIZE(48, 29);
+static const Vec2 STARSHIP_SIZE(21, 27);
+static const float CENTIPEDE_SPEED = 100.0f;
+static const float LASER_SPEED = 500.0f;
+static const float SPIDER_SPEED = 250.0f;
+static const float TICK = 1.0f / 120.0f;
+
+// entity updates per repetition, so small counts run enough ticks to time
+static const long WORK_PER_REP = 1L << 21;
+
+// stock game has 30 mushrooms on a 29 by 19 tile field
+static const int STOCK_MUSHROOMS = 30;
+
+struct Result
+{
+    std::string kernel;
+    int count;
+    std::string op;
+    double nsPerOp;
+};
+
+// keeps the compiler from dropping results nobody reads
+static volatile long sink;
+
+/**
+ * field with room for count mushrooms at the stock density, the stock
+ * field for the stock count. scaleOf() tiles the stock field k by k
+ */
+static int scaleOf(int mushroomCount)
+{
+    return std::max(1, static_cast<int>(std::ceil(std::sqrt(mushroomCount / static_cast<double>(STOCK_MUSHROOMS)))));
+}
+
+static MushroomField makeField(int mushroomCount, GameRandom& gen)
+{
+    int scale = scaleOf(mushroomCount);
+    MushroomField field(Vec2(8, TOP_AREA_HEIGHT), MUSHROOM_SIZE, 29 * scale, 19 * scale);
+    field.scatter(mushroomCount, 17 * scale, gen);
+    return field;
+}
+
+static AABB fieldBounds(const MushroomField& field)
+{
+    const TileLayout& layout = field.getLayout();
+    return AABB(layout.origin.x, layout.origin.y, layout.columns * layout.tileSize.x, layout.rows * layout.tileSize.y);
+}
+
+static long ticksFor(int count)
+{
+    return std::max(8L, WORK_PER_REP / count);
+}
+
+/**
+ * runs setup() untimed and body() timed reps times, returns the fastest
+ * time per op. body() returns a value that goes to the sink
+ */
+template <typename Setup, typename Body>
+static double timeBest(int reps, long ops, Setup setup, Body body)
+{
+    double best = 0.0;
+    for (int rep = 0; rep < reps; ++rep)
+    {
+        setup();
+        auto start = std::chrono::steady_clock::now();
+        sink = sink + body();
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        if (rep == 0 || ns < best)
+        {
+            best = ns;
+        }
+    }
+    return best / ops;
+}
+
+// overlapsAny and firstOverlap on random starship, spider and laser boxes
+static double benchMushroomQuery(int count, int reps)
+{
+    GameRandom gen(1);
+    MushroomField field = makeField(count, gen);
+    AABB area = fieldBounds(field);
+
+    const Vec2 sizes[] = {STARSHIP_SIZE, SPIDER_SIZE, LASER_SIZE};
+    std::vector<AABB> boxes(4096);
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        const Vec2& size = sizes[i % 3];
+        boxes[i] = AABB(gen.nextFloat(area.left, area.right() - size.x),
+                        gen.nextFloat(area.top, area.bottom() - size.y), size.x, size.y);
+    }
+
+    long passes = std::max(1L, ticksFor(count) * count / static_cast<long>(boxes.size()));
+    return timeBest(reps, passes * static_cast<long>(boxes.size()), [] {}, [&]
+    {
+        long found = 0;
+        for (long pass = 0; pass < passes; ++pass)
+        {
+            for (const AABB& box : boxes)
+            {
+                found += field.overlapsAny(box) ? 1 : 0;
+                found += field.firstOverlap(box);
+            }
+        }
+        return found;
+    });
+}
+
+// every head moves and turns and lays its body on the path behind it
+static double benchCentipedeUpdate(int count, int reps)
+{
+    GameRandom gen(2);
+    int length = std::min(count, 12);
+    int centipedeCount = count / length;
+    MushroomField field = makeField(centipedeCount * STOCK_MUSHROOMS, gen);
+    const TileLayout& layout = field.getLayout();
+
+    SegmentPool segments;
+    std::vector<ECE_Centipede> centipedes;
+    long ticks = ticksFor(count);
+
+    auto setup = [&]
+    {
+        segments.clear();
+        centipedes.clear();
+        for (int i = 0; i < centipedeCount; ++i)
+        {
+            Vec2 start(WIDTH - HEAD_SIZE.x, layout.origin.y + (i % layout.rows) * layout.tileSize.y);
+            centipedes.push_back(ECE_Centipede(segments, HEAD_SIZE, BODY_SIZE, length, start, CENTIPEDE_SPEED));
+        }
+    };
+    return timeBest(reps, ticks, setup, [&]
+    {
+        for (long tick = 0; tick < ticks; ++tick)
+        {
+            for (auto& centipede : centipedes)
+            {
+                centipede.update(TICK, segments, field);
+            }
+        }
+        return static_cast<long>(segments.y[segments.size() - 1]);
+    });
+}
+
+// lasers fly up, hit mushrooms and are replaced at the bottom of the field
+static double benchLaserUpdate(int count, int reps)
+{
+    GameRandom gen(3);
+    MushroomField start = makeField(count, gen);
+    MushroomField field = start;
+    AABB area = fieldBounds(field);
+
+    LaserPool lasers(count);
+    long ticks = ticksFor(count);
+
+    auto setup = [&]
+    {
+        field = start;
+        lasers.clear();
+        GameRandom spawnGen(4);
+        for (int i = 0; i < count; ++i)
+        {
+            lasers.spawn(Vec2(spawnGen.nextFloat(area.left, area.right() - LASER_SIZE.x),
+                              spawnGen.nextFloat(area.top, area.bottom())), LASER_SPEED);
+        }
+    };
+    return timeBest(reps, ticks, setup, [&]
+    {
+        long hits = 0;
+        for (long tick = 0; tick < ticks; ++tick)
+        {
+            // same loops as GameWorld::updateLasers and collideLasers
+            int removed = 0;
+            for (int i = 0; i < lasers.size();)
+            {
+                lasers[i].savePrevious();
+                lasers[i].update(TICK);
+
+                // swept over the tick, like the game
+                float hitTime = 1.0f;
+                AABB startBounds(lasers[i].getPreviousPosition(), LASER_SIZE);
+                int hit = field.sweep(startBounds, lasers[i].getPosition() - lasers[i].getPreviousPosition(), hitTime);
+                if (hit >= 0)
+                {
+                    field.hit(hit);
+                    lasers.remove(i);
+                    ++removed;
+                    ++hits;
+                } else if (lasers[i].getPosition().y + LASER_SIZE.y < area.top)
+                {
+                    lasers.remove(i);
+                    ++removed;
+                } else
+                {
+                    ++i;
+                }
+            }
+
+            // keeps the count steady, spread across the bottom row
+            for (int i = 0; i < removed; ++i)
+            {
+                float x = area.left + (hits + i) % static_cast<long>(area.width - LASER_SIZE.x);
+                lasers.spawn(Vec2(x, area.bottom()), LASER_SPEED);
+            }
+        }
+        return hits;
+    });
+}
+
+/**
+ * half the boxes are lasers flying up, half are segments crawling along
+ * rows. every tick moves them all and collects the laser to segment pairs
+ */
+static double benchBroadphase(int count, int reps)
+{
+    GameRandom gen(8);
+    MushroomField field = makeField(count, gen);
+    AABB area = fieldBounds(field);
+
+    int laserCount = std::max(1, count / 2);
+    int segmentCount = std::max(1, count - laserCount);
+    std::vector<Vec2> lasers(laserCount);
+    std::vector<Vec2> segments(segmentCount);
+    std::vector<int> laserProxies(laserCount);
+    std::vector<int> segmentProxies(segmentCount);
+    Broadphase broadphase(Broadphase::AXIS_Y);
+    std::vector<BroadphasePair> pairs;
+    long ticks = ticksFor(count);
+
+    auto setup = [&]
+    {
+        broadphase.clear();
+        GameRandom spawnGen(9);
+        for (int i = 0; i < laserCount; ++i)
+        {
+            lasers[i] = Vec2(spawnGen.nextFloat(area.left, area.right() - LASER_SIZE.x),
+                             spawnGen.nextFloat(area.top, area.bottom()));
+            laserProxies[i] = broadphase.add(AABB(lasers[i], LASER_SIZE), 1, 2, i);
+        }
+        for (int i = 0; i < segmentCount; ++i)
+        {
+            int row = spawnGen.nextInt(0, field.getLayout().rows - 1);
+            segments[i] = Vec2(spawnGen.nextFloat(area.left, area.right() - BODY_SIZE.x),
+                               area.top + row * MUSHROOM_SIZE.y);
+            segmentProxies[i] = broadphase.add(AABB(segments[i], BODY_SIZE), 2, 1, i);
+        }
+    };
+    return timeBest(reps, ticks, setup, [&]
+    {
+        long found = 0;
+        for (long tick = 0; tick < ticks; ++tick)
+        {
+            for (int i = 0; i < laserCount; ++i)
+            {
+                lasers[i].y -= LASER_SPEED * TICK;
+                if (lasers[i].y + LASER_SIZE.y < area.top)
+                {
+                    // a new shot from the bottom, like the game fires one
+                    lasers[i].y = area.bottom();
+                    broadphase.remove(laserProxies[i]);
+                    laserProxies[i] = broadphase.add(AABB(lasers[i], LASER_SIZE), 1, 2, i);
+                }
+                broadphase.move(laserProxies[i], AABB(lasers[i], LASER_SIZE));
+            }
+            for (int i = 0; i < segmentCount; ++i)
+            {
+                segments[i].x += CENTIPEDE_SPEED * TICK;
+                if (segments[i].x > area.right() - BODY_SIZE.x)
+                {
+                    segments[i].x = area.left;
+                }
+                broadphase.move(segmentProxies[i], AABB(segments[i], BODY_SIZE));
+            }
+
+            pairs.clear();
+            broadphase.findPairs(pairs);
+            found += static_cast<long>(pairs.size());
+        }
+        return found;
+    });
+}
+
+/**
+ * random laser paths against count segment boxes packed in a batch. the
+ * vector and the scalar kernel share the setup, so their ns per box show
+ * the speedup directly
+ */
+template <bool Vector>
+static double benchBoxBatch(int count, int reps)
+{
+    GameRandom gen(10);
+    MushroomField field = makeField(count, gen);
+    AABB area = fieldBounds(field);
+
+    BoxBatch boxes;
+    for (int i = 0; i < count; ++i)
+    {
+        boxes.add(AABB(gen.nextFloat(area.left, area.right() - HEAD_SIZE.x),
+                       gen.nextFloat(area.top, area.bottom() - HEAD_SIZE.y), HEAD_SIZE.x, HEAD_SIZE.y));
+    }
+    std::vector<AABB> queries(64);
+    for (AABB& query : queries)
+    {
+        query = AABB(gen.nextFloat(area.left, area.right() - LASER_SIZE.x),
+                     gen.nextFloat(area.top, area.bottom() - LASER_SIZE.y), LASER_SIZE.x, LASER_SIZE.y);
+        query = query.swept(Vec2(0.0f, -LASER_SPEED * TICK));
+    }
+
+    long passes = std::max(1L, ticksFor(count) / static_cast<long>(queries.size()));
+    return timeBest(reps, passes * static_cast<long>(queries.size()) * count, [] {}, [&]
+    {
+        long found = 0;
+        for (long pass = 0; pass < passes; ++pass)
+        {
+            for (const AABB& query : queries)
+            {
+                for (int first = 0; first < count; first += BoxBatch::MASK_BITS)
+                {
+                    std::uint32_t bits = Vector ? boxes.hitMask(query, first) : boxes.hitMaskScalar(query, first);
+                    found += bits != 0 ? 1 : 0;
+                }
+            }
+        }
+        return found;
+    });
+}
+
+struct BenchSpider
+{
+    Vec2 position;
+    Vec2 direction;
+    float changeDirectionTime;
+};
+
+// random walk inside the field, eating every mushroom touched
+static double benchSpiderUpdate(int count, int reps)
+{
+    GameRandom gen(5);
+    MushroomField start = makeField(count, gen);
+    MushroomField field = start;
+    AABB area = fieldBounds(field);
+
+    std::vector<BenchSpider> spiders(count);
+    GameRandom walkGen;
+    long ticks = ticksFor(count);
+
+    auto setup = [&]
+    {
+        field = start;
+        walkGen.seed(6);
+        for (auto& spider : spiders)
+        {
+            spider.position = Vec2(walkGen.nextFloat(area.left, area.right() - SPIDER_SIZE.x),
+                                   walkGen.nextFloat(area.top, area.bottom() - SPIDER_SIZE.y));
+            spider.direction = Vec2(1.0f, 0.0f);
+            spider.changeDirectionTime = walkGen.nextFloat(0.0f, 1.0f);
+        }
+    };
+    return timeBest(reps, ticks, setup, [&]
+    {
+        long eaten = 0;
+        for (long tick = 0; tick < ticks; ++tick)
+        {
+            // same steps as GameWorld::updateSpider
+            for (auto& spider : spiders)
+            {
+                spider.changeDirectionTime += TICK;
+                if (spider.changeDirectionTime >= 1.0f)
+                {
+                    spider.changeDirectionTime = 0.0f;
+                    float dirX = walkGen.nextFloat(-1.0f, 1.0f);
+                    float dirY = walkGen.nextFloat(-1.0f, 1.0f);
+                    float magnitude = std::sqrt(dirX * dirX + dirY * dirY);
+                    if (magnitude != 0)
+                    {
+                        spider.direction = Vec2(dirX / magnitude, dirY / magnitude);
+                    }
+                }
+                spider.position += spider.direction * (SPIDER_SPEED * TICK);
+
+                if (spider.position.x < area.left || spider.position.x > area.right() - SPIDER_SIZE.x)
+                {
+                    spider.position.x = std::min(std::max(spider.position.x, area.left), area.right() - SPIDER_SIZE.x);
+                    spider.direction.x = -spider.direction.x;
+                }
+                if (spider.position.y < area.top || spider.position.y > area.bottom() - SPIDER_SIZE.y)
+                {
+                    spider.position.y = std::min(std::max(spider.position.y, area.top), area.bottom() - SPIDER_SIZE.y);
+                    spider.direction.y = -spider.direction.y;
+                }
+
+                field.forEachOverlap(AABB(spider.position, SPIDER_SIZE), [&](int cell)
+                {
+                    field.destroy(cell);
+                    ++eaten;
+                });
+            }
+        }
+        return eaten;
+    });
+}
+
+/**
+ * mushrooms shot away, eaten and grown back on random tiles, each op is
+ * one tile change with its navigation fix up. every tile is toggled an
+ * even number of times, so each rep ends on the field it started with
+ */
+static double benchMushroomChurn(int count, int reps)
+{
+    GameRandom gen(8);
+    MushroomField field = makeField(count, gen);
+    const TileLayout& layout = field.getLayout();
+
+    std::vector<int> cells(4096);
+    for (int& cell : cells)
+    {
+        cell = gen.nextInt(0, layout.cellCount() - 1);
+    }
+
+    long passes = 2 * std::max(1L, ticksFor(count) * count / static_cast<long>(2 * cells.size()));
+    return timeBest(reps, passes * static_cast<long>(cells.size()), [] {}, [&]
+    {
+        long placed = 0;
+        for (long pass = 0; pass < passes; ++pass)
+        {
+            for (int cell : cells)
+            {
+                if (field.isOccupied(cell))
+                {
+                    field.destroy(cell);
+                } else
+                {
+                    placed += field.place(cell) ? 1 : 0;
+                }
+            }
+        }
+        return placed;
+    });
+}
+
+// one op is a whole new field
+static double benchFieldGeneration(int count, int reps)
+{
+    GameRandom gen(7);
+    MushroomField field = makeField(count, gen);
+    int spawnRows = 17 * scaleOf(count);
+    long fields = std::max(4L, WORK_PER_REP / 4 / count);
+
+    return timeBest(reps, fields, [] {}, [&]
+    {
+        long placed = 0;
+        for (long i = 0; i < fields; ++i)
+        {
+            placed += field.scatter(count, spawnRows, gen);
+        }
+        return placed;
+    });
+}
+
+static bool writeJson(const std::string& path, const std::vector<Result>& results)
+{
+    std::ofstream file(path);
+    if (!file) return false;
+
+    // one result per line, loadJson() relies on it
+    file << "{\n  \"benchmark\": \"centipede_bench\",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& result = results[i];
+        char line[256];
+        std::snprintf(line, sizeof(line),
+                      "    {\"kernel\": \"%s\", \"count\": %d, \"op\": \"%s\", \"ns_per_op\": %.3f}%s\n",
+                      result.kernel.c_str(), result.count, result.op.c_str(), result.nsPerOp,
+                      i + 1 < results.size() ? "," : "");
+        file << line;
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+// string value after "key": on the line
+static bool jsonString(const std::string& line, const char* key, std::string& value)
+{
+    std::string pattern = std::string("\"") + key + "\": \"";
+    size_t start = line.find(pattern);
+    if (start == std::string::npos) return false;
+    start += pattern.size();
+    size_t end = line.find('"', start);
+    if (end == std::string::npos) return false;
+    value = line.substr(start, end - start);
+    return true;
+}
+
+static bool jsonNumber(const std::string& line, const char* key, double& value)
+{
+    std::string pattern = std::string("\"") + key + "\": ";
+    size_t start = line.find(pattern);
+    if (start == std::string::npos) return false;
+    value = std::strtod(line.c_str() + start + pattern.size(), nullptr);
+    return true;
+}
+
+// reads files written by writeJson()
+static bool loadJson(const std::string& path, std::vector<Result>& results)
+{
+    std::ifstream file(path);
+    if (!file) return false;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        Result result;
+        double count;
+        if (jsonString(line, "kernel", result.kernel) && jsonNumber(line, "count", count)
+            && jsonString(line, "op", result.op) && jsonNumber(line, "ns_per_op", result.nsPerOp))
+        {
+            result.count = static_cast<int>(count);
+            results.push_back(result);
+        }
+    }
+    return true;
+}
+
+// returns the number of kernels slower than baseline by more than threshold percent
+static int compare(const std::vector<Result>& baseline, const std::vector<Result>& results, double threshold)
+{
+    std::printf("\n%-18s %8s %14s %14s %9s\n", "kernel", "count", "baseline ns", "current ns", "change");
+
+    int regressions = 0;
+    for (const Result& result : results)
+    {
+        auto match = std::find_if(baseline.begin(), baseline.end(), [&](const Result& old)
+        {
+            return old.kernel == result.kernel && old.count == result.count;
+        });
+        if (match == baseline.end())
+        {
+            std::printf("%-18s %8d %14s %14.1f %9s\n", result.kernel.c_str(), result.count, "-", result.nsPerOp, "new");
+            continue;
+        }
+
+        double change = (result.nsPerOp / match->nsPerOp - 1.0) * 100.0;
+        bool regressed = change > threshold;
+        if (regressed)
+        {
+            ++regressions;
+        }
+        std::printf("%-18s %8d %14.1f %14.1f %+8.1f%%%s\n", result.kernel.c_str(), result.count,
+                    match->nsPerOp, result.nsPerOp, change, regressed ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string outPath = "centipede_bench.json";
+    std::string comparePath;
+    double threshold = 10.0;
+    int reps = 5;
+    int maxCount = 100000;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--out") == 0)
+        {
+            outPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--compare") == 0)
+        {
+            comparePath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--threshold") == 0)
+        {
+            threshold = std::strtod(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--reps") == 0)
+        {
+            reps = std::max(1, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--max-count") == 0)
+        {
+            maxCount = std::atoi(argv[i + 1]);
+        } else
+        {
+            std::cerr << "unknown option " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Result> baseline;
+    if (!comparePath.empty() && !loadJson(comparePath, baseline))
+    {
+        std::cerr << "could not read baseline " << comparePath << std::endl;
+        return 1;
+    }
+
+    struct Kernel
+    {
+        const char* name;
+        const char* op;
+        int stockCount;
+        double (*run)(int count, int reps);
+    };
+
+    // stock counts: 30 mushrooms, 12 segments, a handful of lasers, 1 spider
+    const Kernel kernels[] = {
+        {"mushroom_query", "query", STOCK_MUSHROOMS, benchMushroomQuery},
+        {"centipede_update", "tick", 12, benchCentipedeUpdate},
+        {"laser_update", "tick", 8, benchLaserUpdate},
+        {"spider_update", "tick", 1, benchSpiderUpdate},
+        {"broadphase", "tick", 20, benchBroadphase},
+        {"box_batch", "box", 12, benchBoxBatch<true>},
+        {"box_scalar", "box", 12, benchBoxBatch<false>},
+        {"mushroom_churn", "change", STOCK_MUSHROOMS, benchMushroomChurn},
+        {"field_generation", "field", STOCK_MUSHROOMS, benchFieldGeneration},
+    };
+    const int scaledCounts[] = {1000, 10000, 100000};
+
+    std::vector<Result> results;
+    std::printf("%-18s %8s %8s %14s\n", "kernel", "count", "op", "ns/op");
+    for (const Kernel& kernel : kernels)
+    {
+        std::vector<int> counts(1, kernel.stockCount);
+        for (int count : scaledCounts)
+        {
+            if (count <= maxCount)
+            {
+                counts.push_back(count);
+            }
+        }
+
+        for (int count : counts)
+        {
+            Result result = {kernel.name, count, kernel.op, kernel.run(count, reps)};
+            std::printf("%-18s %8d %8s %14.1f\n", result.kernel.c_str(), result.count, result.op.c_str(), result.nsPerOp);
+            std::fflush(stdout);
+            results.push_back(result);
+        }
+    }
+
+    if (!writeJson(outPath, results))
+    {
+        std::cerr << "could not write " << outPath << std::endl;
+        return 1;
+    }
+    std::printf("results written to %s\n", outPath.c_str());
+
+    if (!comparePath.empty())
+    {
+        int regressions = compare(baseline, results, threshold);
+        std::printf("%d regression(s) over %.1f%%\n", regressions, threshold);
+        return regressions > 0 ? 2 : 0;
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Compares one window.draw() per sprite against
+ * SpriteBatch as the entity count grows. Draws into an offscreen
+ * RenderTexture the size of the game window and reports draw calls and the
+ * average frame time for both paths. Needs an OpenGL context.
+ *
+ * usage: sprite_batch_bench [frames]
+ */
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "GameTypes.h"
+#include "SpriteBatch.h"
+
+using namespace sf;
+
+// solid color stand ins for the game textures
+static void makeTexture(Texture& texture, unsigned int width, unsigned int height, const Color& color)
+{
+    Image image;
+    image.create(width, height, color);
+    texture.loadFromImage(image);
+}
+
+int main(int argc, char* argv[])
+{
+    int frames = argc > 1 ? std::atoi(argv[1]) : 60;
+
+    RenderTexture target;
+    if (!target.create(WIDTH, HEIGHT))
+    {
+        std::fprintf(stderr, "could not create a render texture\n");
+        return 1;
+    }
+
+    // mushroom, head, body and laser sized textures
+    Texture textures[4];
+    makeTexture(textures[0], 27, 26, Color::Green);
+    makeTexture(textures[1], 24, 27, Color::Red);
+    makeTexture(textures[2], 22, 24, Color::Yellow);
+    makeTexture(textures[3], 2, 15, Color::White);
+
+    std::printf("%10s %8s %12s %12s\n", "entities", "path", "draw calls", "ms/frame");
+
+    const int counts[] = {100, 1000, 10000, 100000};
+    for (int count : counts)
+    {
+        // entities are grouped by kind like the game draws them
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> disX(0.0f, WIDTH);
+        std::uniform_real_distribution<float> disY(0.0f, HEIGHT);
+        std::vector<Vector2f> positions(count);
+        std::vector<int> kinds(count);
+        for (int i = 0; i < count; ++i)
+        {
+            positions[i] = Vector2f(disX(gen), disY(gen));
+            kinds[i] = i * 4 / count;
+        }
+
+        // one draw per sprite
+        Sprite sprite;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            target.clear();
+            for (int i = 0; i < count; ++i)
+            {
+                sprite.setTexture(textures[kinds[i]], true);
+                sprite.setPosition(positions[i]);
+                target.draw(sprite);
+            }
+            target.display();
+        }
+        double naiveMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+        std::printf("%10d %8s %12d %12.3f\n", count, "sprite", count, naiveMs);
+
+        // one draw per texture
+        SpriteBatch batch;
+        start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            target.clear();
+            batch.clear();
+            for (int i = 0; i < count; ++i)
+            {
+                batch.add(textures[kinds[i]], positions[i].x, positions[i].y);
+            }
+            batch.draw(target);
+            target.display();
+        }
+        double batchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+        std::printf("%10d %8s %12d %12.3f\n", count, "batch", batch.getDrawCalls(), batchMs);
+    }
+
+    return 0;
+}
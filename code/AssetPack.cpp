@@ -0,0 +1,251 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Memory mapping, lookup and writing of asset
+ * packs. The structs are read in place, so a pack only opens on little
+ * endian machines, which is every machine the game targets.
+ */
+#include "AssetPack.h"
+
+#include <cstring>
+#include <fstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char PACK_MAGIC[4] = {'C', 'P', 'A', 'K'};
+static const std::uint16_t PACK_VERSION = 1;
+static const std::size_t PACK_ALIGNMENT = 64;
+
+std::uint32_t packHash(const char* name)
+{
+    std::uint32_t hash = 2166136261u;
+    for (; *name != '\0'; ++name)
+    {
+        hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+    }
+    return hash;
+}
+
+static bool littleEndian()
+{
+    std::uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+AssetPack::~AssetPack()
+{
+    close();
+}
+
+bool AssetPack::open(const std::string& path)
+{
+    close();
+    if (!littleEndian()) return false;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr)
+    {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    fileSize = static_cast<std::size_t>(size.QuadPart);
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) return false;
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size == 0)
+    {
+        ::close(file);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file); // the mapping keeps the file alive
+    if (view == MAP_FAILED) return false;
+    fileSize = static_cast<std::size_t>(info.st_size);
+#endif
+
+    base = static_cast<const unsigned char*>(view);
+    header = reinterpret_cast<const PackHeader*>(base);
+    entries = reinterpret_cast<const PackEntry*>(base + sizeof(PackHeader));
+    index = reinterpret_cast<const std::uint32_t*>(entries + (fileSize >= sizeof(PackHeader) ? header->entryCount : 0));
+
+    if (!validate())
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void AssetPack::close()
+{
+    if (base != nullptr)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(base);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#else
+        munmap(const_cast<unsigned char*>(base), fileSize);
+#endif
+    }
+    base = nullptr;
+    fileSize = 0;
+    header = nullptr;
+    entries = nullptr;
+    index = nullptr;
+}
+
+// every offset is checked once here so lookups can trust the file
+bool AssetPack::validate() const
+{
+    if (fileSize < sizeof(PackHeader)) return false;
+    if (std::memcmp(header->magic, PACK_MAGIC, 4) != 0 || header->version != PACK_VERSION) return false;
+
+    std::uint64_t indexSize = header->indexSize;
+    // the writer leaves at least half the slots empty, a full index is not a pack of ours
+    if (indexSize == 0 || (indexSize & (indexSize - 1)) != 0 || indexSize <= header->entryCount) return false;
+
+    std::uint64_t tableEnd = sizeof(PackHeader) + std::uint64_t(header->entryCount) * sizeof(PackEntry)
+        + indexSize * sizeof(std::uint32_t);
+    if (tableEnd > fileSize) return false;
+
+    for (std::uint32_t i = 0; i < header->entryCount; ++i)
+    {
+        const PackEntry& entry = entries[i];
+        if (std::memchr(entry.name, '\0', sizeof(entry.name)) == nullptr) return false;
+        if (entry.offset > fileSize || entry.size > fileSize - entry.offset) return false;
+    }
+    for (std::uint64_t slot = 0; slot < indexSize; ++slot)
+    {
+        if (index[slot] > header->entryCount) return false;
+    }
+    return true;
+}
+
+const PackEntry* AssetPack::find(const char* name) const
+{
+    if (base == nullptr) return nullptr;
+
+    // linear probing, the index is at most half full. a damaged index can
+    // still list one entry in every slot, so the probes stop after a lap
+    std::uint32_t mask = header->indexSize - 1;
+    std::uint32_t slot = packHash(name) & mask;
+    for (std::uint32_t probe = 0; probe < header->indexSize; ++probe)
+    {
+        if (index[slot] == 0) break;
+
+        const PackEntry& entry = entries[index[slot] - 1];
+        if (std::strcmp(entry.name, name) == 0)
+        {
+            return &entry;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return nullptr;
+}
+
+bool AssetPackWriter::add(const std::string& name, PackKind kind, const std::uint32_t (&params)[4],
+                          const void* payload, std::size_t size)
+{
+    Pending item = {};
+    if (name.size() >= sizeof(item.entry.name)) return false;
+    for (const auto& other : pending)
+    {
+        if (name == other.entry.name) return false;
+    }
+
+    std::memcpy(item.entry.name, name.c_str(), name.size() + 1);
+    item.entry.kind = kind;
+    std::memcpy(item.entry.params, params, sizeof(item.entry.params));
+    item.entry.size = size;
+    const unsigned char* bytes = static_cast<const unsigned char*>(payload);
+    item.payload.assign(bytes, bytes + size);
+    pending.push_back(std::move(item));
+    return true;
+}
+
+static std::uint64_t alignUp(std::uint64_t value)
+{
+    return (value + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+}
+
+bool AssetPackWriter::write(const std::string& path) const
+{
+    PackHeader header = {};
+    std::memcpy(header.magic, PACK_MAGIC, 4);
+    header.version = PACK_VERSION;
+    header.entryCount = static_cast<std::uint32_t>(pending.size());
+    header.indexSize = 1;
+    while (header.indexSize < header.entryCount * 2)
+    {
+        header.indexSize *= 2;
+    }
+
+    std::vector<std::uint32_t> index(header.indexSize, 0);
+    std::uint32_t mask = header.indexSize - 1;
+    std::vector<PackEntry> entries;
+    std::uint64_t offset = alignUp(sizeof(PackHeader) + pending.size() * sizeof(PackEntry)
+                                   + index.size() * sizeof(std::uint32_t));
+    for (std::size_t i = 0; i < pending.size(); ++i)
+    {
+        PackEntry entry = pending[i].entry;
+        entry.offset = entry.size > 0 ? offset : 0;
+        offset = alignUp(offset + entry.size);
+        entries.push_back(entry);
+
+        std::uint32_t slot = packHash(entry.name) & mask;
+        while (index[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        index[slot] = static_cast<std::uint32_t>(i + 1);
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(PackEntry));
+    out.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(std::uint32_t));
+
+    static const char padding[PACK_ALIGNMENT] = {};
+    for (std::size_t i = 0; i < pending.size(); ++i)
+    {
+        if (entries[i].size == 0) continue;
+        std::uint64_t position = static_cast<std::uint64_t>(out.tellp());
+        out.write(padding, static_cast<std::streamsize>(entries[i].offset - position));
+        out.write(reinterpret_cast<const char*>(pending[i].payload.data()), pending[i].payload.size());
+    }
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,124 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Single file pack of pre-decoded assets, built by
+ * the pack_assets tool so the game skips PNG, TTF and WAV decoding at
+ * startup. The file is memory mapped and entries point straight into the
+ * mapping, nothing is read or copied until a texture or sound buffer is
+ * filled from it. A hash index in the header finds an entry by name with
+ * one or two probes.
+ *
+ * file layout, little endian, every payload 64 byte aligned:
+ *   PackHeader, PackEntry[entryCount],
+ *   u32 index[indexSize] (entry number + 1, 0 is empty), payloads
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum PackKind : std::uint32_t
+{
+    PACK_IMAGE = 1,  // rgba8, params width, height
+    PACK_REGION = 2, // rect inside the atlas image, params left, top, width, height, no payload
+    PACK_BLOB = 3,   // raw file bytes
+    PACK_SOUND = 4,  // int16 samples, params channel count, sample rate
+    PACK_DIGITS = 5  // rgba8 digit glyphs then DigitMetrics, params width, height
+};
+
+struct PackHeader
+{
+    char magic[4]; // "CPAK"
+    std::uint16_t version;
+    std::uint16_t reserved;
+    std::uint32_t entryCount;
+    std::uint32_t indexSize; // power of two
+};
+
+struct PackEntry
+{
+    char name[28]; // zero terminated
+    std::uint32_t kind;
+    std::uint32_t params[4];
+    std::uint64_t offset; // from the start of the file
+    std::uint64_t size;
+};
+
+// metrics of the glyphs of a PACK_DIGITS entry, one cell per digit
+struct DigitMetrics
+{
+    float advance[10];
+    float inkTop;
+    float inkHeight;
+};
+
+static_assert(sizeof(PackHeader) == 16, "pack header layout");
+static_assert(sizeof(PackEntry) == 64, "pack entry layout");
+
+// read side, the mapping lives as long as the pack
+class AssetPack
+{
+public:
+    AssetPack() = default;
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // false if the file is missing, truncated or from another version
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return base != nullptr; }
+
+    // nullptr if there is no entry of that name
+    const PackEntry* find(const char* name) const;
+
+    const void* data(const PackEntry& entry) const
+    {
+        return base + entry.offset;
+    }
+
+    int getEntryCount() const { return header ? static_cast<int>(header->entryCount) : 0; }
+    const PackEntry& getEntry(int index) const { return entries[index]; }
+
+private:
+    bool validate() const;
+
+    const unsigned char* base = nullptr;
+    std::size_t fileSize = 0;
+    const PackHeader* header = nullptr;
+    const PackEntry* entries = nullptr;
+    const std::uint32_t* index = nullptr;
+
+#if defined(_WIN32)
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+// write side, used by pack_assets
+class AssetPackWriter
+{
+public:
+    // false if the name is too long or already taken
+    bool add(const std::string& name, PackKind kind, const std::uint32_t (&params)[4],
+             const void* payload, std::size_t size);
+
+    bool write(const std::string& path) const;
+
+private:
+    struct Pending
+    {
+        PackEntry entry;
+        std::vector<unsigned char> payload;
+    };
+
+    std::vector<Pending> pending;
+};
+
+// FNV-1a of a zero terminated name, the index hash
+std::uint32_t packHash(const char* name);
@@ -0,0 +1,147 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Background decoding for the asset registry.
+ */
+#include "AssetRegistry.h"
+
+#include <chrono>
+
+#include "TaskScheduler.h"
+#include "Trace.h"
+
+AssetRegistry::~AssetRegistry()
+{
+    if (loader.joinable())
+    {
+        loader.join();
+    }
+}
+
+ImageHandle AssetRegistry::requestImage(const std::string& path)
+{
+    ImageHandle handle;
+    handle.slot = request(IMAGE_ASSET, path);
+    return handle;
+}
+
+FontHandle AssetRegistry::requestFont(const std::string& path)
+{
+    FontHandle handle;
+    handle.slot = request(FONT_ASSET, path);
+    return handle;
+}
+
+SoundHandle AssetRegistry::requestSound(const std::string& path)
+{
+    SoundHandle handle;
+    handle.slot = request(SOUND_ASSET, path);
+    return handle;
+}
+
+int AssetRegistry::request(AssetKind kind, const std::string& path)
+{
+    if (started) return -1;
+
+    // same kind and path is the same asset
+    std::string key = std::to_string(static_cast<int>(kind)) + ":" + path;
+    auto found = entryByPath.find(key);
+    if (found != entryByPath.end())
+    {
+        return entries[found->second].slot;
+    }
+
+    int slot = slotCount[kind]++;
+    entryByPath.emplace(key, static_cast<int>(entries.size()));
+    entries.push_back({kind, slot, path, false});
+    return slot;
+}
+
+void AssetRegistry::startLoading(int threads)
+{
+    if (started) return;
+    started = true;
+
+    images.resize(slotCount[IMAGE_ASSET]);
+    fonts.resize(slotCount[FONT_ASSET]);
+    sounds.resize(slotCount[SOUND_ASSET]);
+
+    // the loader thread works too, so it counts as one of the threads
+    int workers = threads > 1 ? threads - 1 : 0;
+    loader = std::thread([this, workers]
+    {
+        traceSetThreadName("loader");
+        auto start = std::chrono::steady_clock::now();
+
+        TaskScheduler pool(workers);
+        pool.parallelFor(static_cast<int>(entries.size()), 1, [this](int begin, int end)
+        {
+            for (int i = begin; i < end; ++i)
+            {
+                decode(entries[i]);
+            }
+        });
+
+        loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    });
+}
+
+void AssetRegistry::decode(Entry& entry)
+{
+    TRACE_ZONE("decode");
+    switch (entry.kind)
+    {
+    case IMAGE_ASSET:
+        entry.loaded = images[entry.slot].loadFromFile(entry.path);
+        break;
+    case FONT_ASSET:
+        entry.loaded = fonts[entry.slot].loadFromFile(entry.path);
+        break;
+    case SOUND_ASSET:
+        entry.loaded = sounds[entry.slot].loadFromFile(entry.path);
+        break;
+    }
+}
+
+int AssetRegistry::wait()
+{
+    if (loader.joinable())
+    {
+        loader.join();
+    }
+
+    int failed = 0;
+    for (const auto& entry : entries)
+    {
+        if (!entry.loaded) ++failed;
+    }
+    return failed;
+}
+
+void AssetRegistry::releaseImages()
+{
+    for (auto& image : images)
+    {
+        image = sf::Image();
+    }
+}
+
+std::vector<std::string> AssetRegistry::getFailures() const
+{
+    std::vector<std::string> paths;
+    for (const auto& entry : entries)
+    {
+        if (!entry.loaded) paths.push_back(entry.path);
+    }
+    return paths;
+}
+
+bool AssetRegistry::loadedAt(AssetKind kind, int slot) const
+{
+    for (const auto& entry : entries)
+    {
+        if (entry.kind == kind && entry.slot == slot) return entry.loaded;
+    }
+    return false;
+}
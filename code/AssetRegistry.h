@@ -0,0 +1,108 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Loads the game's images, fonts and sounds in the
+ * background. Assets are requested by path up front and each request hands
+ * back a small handle, asking for the same path twice gives the same
+ * handle. startLoading() decodes every file on a pool of threads while the
+ * main thread goes on creating the window, wait() joins them. Decoding
+ * needs no GL context, the texture upload stays on the main thread where
+ * the atlas is built from the decoded images.
+ */
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// handles index the registry's storage and stay valid for its lifetime
+struct ImageHandle
+{
+    int slot = -1;
+};
+
+struct FontHandle
+{
+    int slot = -1;
+};
+
+struct SoundHandle
+{
+    int slot = -1;
+};
+
+class AssetRegistry
+{
+public:
+    AssetRegistry() = default;
+    ~AssetRegistry();
+
+    AssetRegistry(const AssetRegistry&) = delete;
+    AssetRegistry& operator=(const AssetRegistry&) = delete;
+
+    // requests made after startLoading() get an invalid handle
+    ImageHandle requestImage(const std::string& path);
+    FontHandle requestFont(const std::string& path);
+    SoundHandle requestSound(const std::string& path);
+
+    // decodes every request on up to threads threads, returns at once
+    void startLoading(int threads);
+
+    // blocks until loading is done, returns the number of files that failed
+    int wait();
+
+    // only after wait(). a failed file leaves an empty asset
+    bool isLoaded(ImageHandle handle) const { return loadedAt(IMAGE_ASSET, handle.slot); }
+    bool isLoaded(FontHandle handle) const { return loadedAt(FONT_ASSET, handle.slot); }
+    bool isLoaded(SoundHandle handle) const { return loadedAt(SOUND_ASSET, handle.slot); }
+
+    const sf::Image& getImage(ImageHandle handle) const { return images[handle.slot]; }
+    const sf::Font& getFont(FontHandle handle) const { return fonts[handle.slot]; }
+    const sf::SoundBuffer& getSound(SoundHandle handle) const { return sounds[handle.slot]; }
+
+    // the atlas keeps its own copy once it is built
+    void releaseImages();
+
+    // paths of the files that failed to load
+    std::vector<std::string> getFailures() const;
+
+    // wall time from startLoading() to the last decode
+    double getLoadSeconds() const { return loadSeconds; }
+
+private:
+    enum AssetKind
+    {
+        IMAGE_ASSET,
+        FONT_ASSET,
+        SOUND_ASSET
+    };
+
+    struct Entry
+    {
+        AssetKind kind;
+        int slot;
+        std::string path;
+        bool loaded;
+    };
+
+    int request(AssetKind kind, const std::string& path);
+    void decode(Entry& entry);
+    bool loadedAt(AssetKind kind, int slot) const;
+
+    std::vector<Entry> entries;
+    std::unordered_map<std::string, int> entryByPath;
+    int slotCount[3] = {};
+
+    // sized before the threads start, so workers never move them
+    std::vector<sf::Image> images;
+    std::vector<sf::Font> fonts;
+    std::vector<sf::SoundBuffer> sounds;
+
+    std::thread loader;
+    bool started = false;
+    double loadSeconds = 0.0;
+};
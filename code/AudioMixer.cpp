@@ -0,0 +1,127 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Voice allocation and the event to sound table.
+ */
+#include "AudioMixer.h"
+
+struct SoundSettings
+{
+    float length;  // seconds, replaced by the real buffer length when known
+    int priority;  // higher cuts off lower
+    float volume;
+};
+
+static const SoundSettings SOUND_SETTINGS[SOUND_COUNT] = {
+    {0.115f, 0, 0.6f}, // chop, every hit
+    {1.691f, 2, 1.0f}, // death
+    {0.830f, 1, 1.0f}  // out of time, game over
+};
+
+// the same sound started again this soon adds nothing you can hear
+static const double RETRIGGER_SECONDS = 0.03;
+
+AudioMixer::AudioMixer(AudioBackend& backend, int voiceCount)
+    : backend(backend), voices(voiceCount > 0 ? voiceCount : 1), now(0.0)
+{
+    for (int sound = 0; sound < SOUND_COUNT; ++sound)
+    {
+        lengths[sound] = SOUND_SETTINGS[sound].length;
+        lastStart[sound] = -RETRIGGER_SECONDS;
+    }
+}
+
+void AudioMixer::setSoundLength(SoundId sound, float seconds)
+{
+    lengths[sound] = seconds;
+}
+
+// a free voice, else the least important and oldest one that priority may cut off
+int AudioMixer::pickVoice(int priority) const
+{
+    int best = -1;
+    for (int i = 0; i < static_cast<int>(voices.size()); ++i)
+    {
+        const Voice& voice = voices[i];
+        if (voice.sound < 0) return i;
+        if (voice.priority > priority) continue;
+
+        if (best < 0 || voice.priority < voices[best].priority
+            || (voice.priority == voices[best].priority && voice.start < voices[best].start))
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+bool AudioMixer::play(SoundId sound)
+{
+    const SoundSettings& settings = SOUND_SETTINGS[sound];
+    if (now - lastStart[sound] < RETRIGGER_SECONDS)
+    {
+        ++stats.dropped;
+        return false;
+    }
+
+    int index = pickVoice(settings.priority);
+    if (index < 0)
+    {
+        ++stats.dropped;
+        return false;
+    }
+
+    Voice& voice = voices[index];
+    if (voice.sound >= 0)
+    {
+        ++stats.stolen;
+    }
+    voice.sound = sound;
+    voice.priority = settings.priority;
+    voice.start = now;
+    voice.end = now + lengths[sound];
+    lastStart[sound] = now;
+
+    backend.play(index, sound, settings.volume);
+    ++stats.played;
+    return true;
+}
+
+bool AudioMixer::playEvent(const GameEvent& event)
+{
+    switch (event.type)
+    {
+    case EVENT_MUSHROOM_HIT:
+    case EVENT_CENTIPEDE_HIT:
+    case EVENT_SPIDER_KILLED:
+        return play(SOUND_CHOP);
+    case EVENT_PLAYER_DIED:
+        return play(SOUND_DEATH);
+    case EVENT_GAME_OVER:
+        return play(SOUND_OUT_OF_TIME);
+    }
+    return false;
+}
+
+void AudioMixer::update(float deltaTime)
+{
+    now += deltaTime;
+    for (auto& voice : voices)
+    {
+        if (voice.sound >= 0 && voice.end <= now)
+        {
+            voice.sound = -1; // the backend stops on its own at the end of the buffer
+        }
+    }
+}
+
+int AudioMixer::getActiveVoices() const
+{
+    int active = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice.sound >= 0) ++active;
+    }
+    return active;
+}
@@ -0,0 +1,97 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Sound effects for game events. The mixer owns a
+ * fixed pool of voices made at startup and plays a sound by handing a free
+ * voice to the backend. With every voice busy it steals the one playing
+ * the least important sound, the oldest first, or drops the new sound if
+ * everything playing matters more. Playing never allocates, so a burst of
+ * hits costs a few comparisons on the thread that plays them.
+ *
+ * The backend does the actual output. NullAudioBackend plays nothing, so
+ * the mixer also runs headless.
+ */
+#pragma once
+
+#include <vector>
+
+#include "GameWorld.h"
+
+// same order as SOUND_FILES in GameAssets.h
+enum SoundId
+{
+    SOUND_CHOP,
+    SOUND_DEATH,
+    SOUND_OUT_OF_TIME,
+    SOUND_COUNT
+};
+
+class AudioBackend
+{
+public:
+    virtual ~AudioBackend() = default;
+
+    // starts sound on voice, cutting off whatever the voice was playing
+    virtual void play(int voice, SoundId sound, float volume) = 0;
+    virtual void stop(int voice) = 0;
+};
+
+class NullAudioBackend : public AudioBackend
+{
+public:
+    void play(int, SoundId, float) override { ++plays; }
+    void stop(int) override {}
+
+    long getPlays() const { return plays; }
+
+private:
+    long plays = 0;
+};
+
+struct MixerStats
+{
+    long played = 0;
+    long stolen = 0;  // played by cutting off another sound
+    long dropped = 0; // every voice was busy with something more important
+};
+
+class AudioMixer
+{
+public:
+    AudioMixer(AudioBackend& backend, int voiceCount = 16);
+
+    // length in seconds, the defaults are the files in sound/
+    void setSoundLength(SoundId sound, float seconds);
+
+    // false if the sound was dropped
+    bool play(SoundId sound);
+
+    // the sound a game event makes, false if it makes none or was dropped
+    bool playEvent(const GameEvent& event);
+
+    // advances the mixer clock, voices whose sound ended become free
+    void update(float deltaTime);
+
+    int getVoiceCount() const { return static_cast<int>(voices.size()); }
+    int getActiveVoices() const;
+    const MixerStats& getStats() const { return stats; }
+
+private:
+    struct Voice
+    {
+        int sound = -1; // -1 is free
+        int priority = 0;
+        double start = 0.0;
+        double end = 0.0;
+    };
+
+    int pickVoice(int priority) const;
+
+    AudioBackend& backend;
+    std::vector<Voice> voices;
+    float lengths[SOUND_COUNT];
+    double lastStart[SOUND_COUNT];
+    double now;
+    MixerStats stats;
+};
@@ -0,0 +1,160 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Packed box storage and the batched overlap test.
+ *
+ * Every path computes the overlap the way AABB::intersects does: the larger
+ * of the two lefts has to be below the smaller of the two rights, and the
+ * same on y. The right and bottom edges are stored already added up, the
+ * same float that AABB::right() and bottom() give, so a box hits here
+ * exactly when intersects() says it does. Padding boxes run from +max to
+ * -max and can never pass the test.
+ */
+#include "BoxBatch.h"
+
+#include <cstddef>
+#include <limits>
+
+#include "CpuFeatures.h"
+
+static const float EMPTY_MIN = std::numeric_limits<float>::max();
+static const float EMPTY_MAX = -std::numeric_limits<float>::max();
+
+void BoxBatch::clear()
+{
+    left.clear();
+    top.clear();
+    right.clear();
+    bottom.clear();
+    count = 0;
+}
+
+int BoxBatch::add(const AABB& box)
+{
+    // grow by a whole mask so hitMask() never reads past the end
+    if (count == static_cast<int>(left.size()))
+    {
+        std::size_t padded = left.size() + MASK_BITS;
+        left.resize(padded, EMPTY_MIN);
+        top.resize(padded, EMPTY_MIN);
+        right.resize(padded, EMPTY_MAX);
+        bottom.resize(padded, EMPTY_MAX);
+    }
+    left[count] = box.left;
+    top[count] = box.top;
+    right[count] = box.right();
+    bottom[count] = box.bottom();
+    return count++;
+}
+
+int BoxBatch::lowestBit(std::uint32_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(bits);
+#else
+    int index = 0;
+    while ((bits & 1u) == 0)
+    {
+        bits >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// boxes from first that are in use, a short batch skips the empty vectors.
+// the vector loops may run up to 7 past it into padding
+int BoxBatch::laneCount(int first) const
+{
+    int lanes = count - first;
+    return lanes < MASK_BITS ? lanes : MASK_BITS;
+}
+
+std::uint32_t BoxBatch::hitMaskScalar(const AABB& query, int first) const
+{
+    float queryRight = query.right();
+    float queryBottom = query.bottom();
+    int lanes = laneCount(first);
+
+    std::uint32_t mask = 0;
+    for (int bit = 0; bit < lanes; ++bit)
+    {
+        int i = first + bit;
+        float interLeft = query.left > left[i] ? query.left : left[i];
+        float interTop = query.top > top[i] ? query.top : top[i];
+        float interRight = queryRight < right[i] ? queryRight : right[i];
+        float interBottom = queryBottom < bottom[i] ? queryBottom : bottom[i];
+        if (interLeft < interRight && interTop < interBottom)
+        {
+            mask |= 1u << bit;
+        }
+    }
+    return mask;
+}
+
+#if defined(CPU_X86)
+
+// 4 boxes per compare, sse2 is part of x86-64
+static std::uint32_t hitMaskSse(const float* left, const float* top, const float* right, const float* bottom,
+                                int lanes, const AABB& query)
+{
+    const __m128 queryLeft = _mm_set1_ps(query.left);
+    const __m128 queryTop = _mm_set1_ps(query.top);
+    const __m128 queryRight = _mm_set1_ps(query.right());
+    const __m128 queryBottom = _mm_set1_ps(query.bottom());
+
+    std::uint32_t mask = 0;
+    for (int i = 0; i < lanes; i += 4)
+    {
+        __m128 interLeft = _mm_max_ps(queryLeft, _mm_loadu_ps(left + i));
+        __m128 interTop = _mm_max_ps(queryTop, _mm_loadu_ps(top + i));
+        __m128 interRight = _mm_min_ps(queryRight, _mm_loadu_ps(right + i));
+        __m128 interBottom = _mm_min_ps(queryBottom, _mm_loadu_ps(bottom + i));
+        __m128 hit = _mm_and_ps(_mm_cmplt_ps(interLeft, interRight), _mm_cmplt_ps(interTop, interBottom));
+        mask |= static_cast<std::uint32_t>(_mm_movemask_ps(hit)) << i;
+    }
+    return mask;
+}
+
+// 8 boxes per compare
+CPU_TARGET_AVX static std::uint32_t hitMaskAvx(const float* left, const float* top, const float* right,
+                                               const float* bottom, int lanes, const AABB& query)
+{
+    const __m256 queryLeft = _mm256_set1_ps(query.left);
+    const __m256 queryTop = _mm256_set1_ps(query.top);
+    const __m256 queryRight = _mm256_set1_ps(query.right());
+    const __m256 queryBottom = _mm256_set1_ps(query.bottom());
+
+    std::uint32_t mask = 0;
+    for (int i = 0; i < lanes; i += 8)
+    {
+        __m256 interLeft = _mm256_max_ps(queryLeft, _mm256_loadu_ps(left + i));
+        __m256 interTop = _mm256_max_ps(queryTop, _mm256_loadu_ps(top + i));
+        __m256 interRight = _mm256_min_ps(queryRight, _mm256_loadu_ps(right + i));
+        __m256 interBottom = _mm256_min_ps(queryBottom, _mm256_loadu_ps(bottom + i));
+        __m256 hit = _mm256_and_ps(_mm256_cmp_ps(interLeft, interRight, _CMP_LT_OQ),
+                                   _mm256_cmp_ps(interTop, interBottom, _CMP_LT_OQ));
+        mask |= static_cast<std::uint32_t>(_mm256_movemask_ps(hit)) << i;
+    }
+    return mask;
+}
+
+#endif
+
+std::uint32_t BoxBatch::hitMask(const AABB& query, int first) const
+{
+#if defined(CPU_X86)
+    static const bool useAvx = cpuHasAvx();
+    int lanes = laneCount(first);
+    if (useAvx)
+    {
+        return hitMaskAvx(left.data() + first, top.data() + first, right.data() + first, bottom.data() + first,
+                          lanes, query);
+    }
+    return hitMaskSse(left.data() + first, top.data() + first, right.data() + first, bottom.data() + first,
+                      lanes, query);
+#else
+    return hitMaskScalar(query, first);
+#endif
+}
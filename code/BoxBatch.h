@@ -0,0 +1,62 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Boxes packed as separate left, top, right and
+ * bottom float arrays so one query box can be tested against 4 of them at
+ * a time with SSE or 8 with AVX. The vector paths give exactly the same
+ * answer as AABB::intersects, touching edges still do not count.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GameTypes.h"
+
+class BoxBatch
+{
+public:
+    // boxes tested by one hitMask() call
+    static const int MASK_BITS = 32;
+
+    void clear();
+
+    // appends box, returns its slot
+    int add(const AABB& box);
+
+    int size() const
+    {
+        return count;
+    }
+
+    // bit i is set when box first + i overlaps query. first is a multiple of MASK_BITS
+    std::uint32_t hitMask(const AABB& query, int first) const;
+
+    // calls fn(slot) for every overlapping box, lowest slot first
+    template <typename Fn>
+    void forEachHit(const AABB& query, Fn fn) const
+    {
+        for (int first = 0; first < count; first += MASK_BITS)
+        {
+            for (std::uint32_t bits = hitMask(query, first); bits != 0; bits &= bits - 1)
+            {
+                fn(first + lowestBit(bits));
+            }
+        }
+    }
+
+    // hitMask() one box at a time, the vector paths give the same bits
+    std::uint32_t hitMaskScalar(const AABB& query, int first) const;
+
+private:
+    static int lowestBit(std::uint32_t bits);
+    int laneCount(int first) const;
+
+    // count rounded up to whole vectors, the padding boxes never hit
+    std::vector<float> left;
+    std::vector<float> top;
+    std::vector<float> right;
+    std::vector<float> bottom;
+    int count = 0;
+};
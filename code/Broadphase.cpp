@@ -0,0 +1,191 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Sorted endpoint list and the sweep.
+ */
+#include "Broadphase.h"
+
+#include <algorithm>
+#include <cstddef>
+
+static int categoryIndex(std::uint32_t category)
+{
+    int index = 0;
+    while (index < Broadphase::MAX_CATEGORIES && (category & (1u << index)) == 0)
+    {
+        ++index;
+    }
+    return index;
+}
+
+// ends before starts at the same value, touching boxes do not overlap. a
+// flat box still opens before it closes
+static bool endpointLess(float aValue, int aCode, float bValue, int bCode)
+{
+    if (aValue != bValue) return aValue < bValue;
+    if ((aCode >> 1) == (bCode >> 1)) return (aCode & 1) < (bCode & 1);
+    return (aCode & 1) > (bCode & 1);
+}
+
+int Broadphase::add(const AABB& box, std::uint32_t category, std::uint32_t mask, int userData)
+{
+    int proxy;
+    if (!freeProxies.empty())
+    {
+        proxy = freeProxies.back();
+        freeProxies.pop_back();
+    } else
+    {
+        proxy = static_cast<int>(proxies.size());
+        proxies.push_back(Proxy());
+    }
+    proxies[proxy] = {box, category, mask, categoryIndex(category), userData, -1, true, false};
+    return proxy;
+}
+
+// sorted endpoints go at the next sweep, until then the slot is not reused
+void Broadphase::remove(int proxy)
+{
+    proxies[proxy].alive = false;
+    if (proxies[proxy].inList)
+    {
+        removedSinceSweep = true;
+    } else
+    {
+        freeProxies.push_back(proxy);
+    }
+}
+
+void Broadphase::move(int proxy, const AABB& box)
+{
+    proxies[proxy].box = box;
+}
+
+void Broadphase::clear()
+{
+    proxies.clear();
+    freeProxies.clear();
+    endpoints.clear();
+    removedSinceSweep = false;
+}
+
+void Broadphase::findPairs(std::vector<BroadphasePair>& pairs)
+{
+    // drop the endpoints of removed boxes, keeping the order of the rest
+    if (removedSinceSweep)
+    {
+        std::size_t kept = 0;
+        for (const Endpoint& endpoint : endpoints)
+        {
+            if (proxies[endpoint.code >> 1].alive)
+            {
+                endpoints[kept++] = endpoint;
+            }
+        }
+        endpoints.resize(kept);
+        for (int proxy = 0; proxy < static_cast<int>(proxies.size()); ++proxy)
+        {
+            if (!proxies[proxy].alive && proxies[proxy].inList)
+            {
+                proxies[proxy].inList = false;
+                freeProxies.push_back(proxy);
+            }
+        }
+        removedSinceSweep = false;
+    }
+
+    // new boxes join at the end and are merged in after the sort
+    std::size_t sortedCount = fullSort ? 0 : endpoints.size();
+    fullSort = false;
+    for (int proxy = 0; proxy < static_cast<int>(proxies.size()); ++proxy)
+    {
+        Proxy& entry = proxies[proxy];
+        if (entry.alive && !entry.inList)
+        {
+            entry.inList = true;
+            endpoints.push_back({0.0f, proxy * 2});
+            endpoints.push_back({0.0f, proxy * 2 + 1});
+        }
+    }
+
+    for (Endpoint& endpoint : endpoints)
+    {
+        const AABB& box = proxies[endpoint.code >> 1].box;
+        if (axis == AXIS_X)
+        {
+            endpoint.value = (endpoint.code & 1) ? box.right() : box.left;
+        } else
+        {
+            endpoint.value = (endpoint.code & 1) ? box.bottom() : box.top;
+        }
+    }
+
+    // insertion sort, close to linear when the list was sorted last tick
+    for (std::size_t i = 1; i < sortedCount; ++i)
+    {
+        Endpoint key = endpoints[i];
+        std::size_t j = i;
+        while (j > 0 && endpointLess(key.value, key.code, endpoints[j - 1].value, endpoints[j - 1].code))
+        {
+            endpoints[j] = endpoints[j - 1];
+            --j;
+        }
+        endpoints[j] = key;
+    }
+
+    // a whole wave spawning at once would make the insertion sort quadratic,
+    // so would a list that was not sorted for a while
+    if (sortedCount < endpoints.size())
+    {
+        auto less = [](const Endpoint& a, const Endpoint& b)
+        {
+            return endpointLess(a.value, a.code, b.value, b.code);
+        };
+        std::sort(endpoints.begin() + sortedCount, endpoints.end(), less);
+        std::inplace_merge(endpoints.begin(), endpoints.begin() + sortedCount, endpoints.end(), less);
+    }
+
+    // sweep, every box between its min and max end is open
+    for (auto& list : active)
+    {
+        list.clear();
+    }
+    for (const Endpoint& endpoint : endpoints)
+    {
+        int proxy = endpoint.code >> 1;
+        Proxy& entry = proxies[proxy];
+        std::vector<int>& own = active[entry.categorySlot];
+
+        if (endpoint.code & 1)
+        {
+            // closes, the last open box takes its slot
+            int moved = own.back();
+            own[entry.activeSlot] = moved;
+            proxies[moved].activeSlot = entry.activeSlot;
+            own.pop_back();
+            continue;
+        }
+
+        // only the open boxes of categories this one collides with
+        for (std::uint32_t bits = entry.mask; bits != 0; bits &= bits - 1)
+        {
+            for (int other : active[categoryIndex(bits & (~bits + 1))])
+            {
+                const Proxy& otherEntry = proxies[other];
+                if ((otherEntry.mask & entry.category) == 0) continue;
+
+                // already overlapping on the sort axis, the other axis decides
+                bool overlap = axis == AXIS_X
+                    ? entry.box.top < otherEntry.box.bottom() && otherEntry.box.top < entry.box.bottom()
+                    : entry.box.left < otherEntry.box.right() && otherEntry.box.left < entry.box.right();
+                if (overlap)
+                {
+                    pairs.push_back({other, proxy});
+                }
+            }
+        }
+        entry.activeSlot = static_cast<int>(own.size());
+        own.push_back(proxy);
+    }
+}
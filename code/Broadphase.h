@@ -0,0 +1,94 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Sweep and prune broadphase for the moving
+ * entities. Every box has a min and a max endpoint on the sort axis and
+ * the endpoint list stays sorted between ticks. Things only move a few
+ * pixels per tick, so re-sorting with insertion sort does a handful of
+ * swaps instead of a full sort. One sweep along the sorted list then
+ * reports every pair whose boxes overlap. The axis along which boxes pass
+ * each other least makes the cheapest sort.
+ *
+ * Each box has one category bit and a mask of the categories it collides
+ * with. Open boxes are kept per category and a new box only looks at the
+ * categories in its mask, so segments overlapping each other on x cost
+ * nothing. A tick costs the number of boxes plus the number of overlaps
+ * between categories that collide, not boxes squared.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GameTypes.h"
+
+struct BroadphasePair
+{
+    int first;  // proxy that was in the sweep first
+    int second;
+};
+
+class Broadphase
+{
+public:
+    static const int MAX_CATEGORIES = 8;
+
+    enum Axis
+    {
+        AXIS_X,
+        AXIS_Y
+    };
+
+    explicit Broadphase(Axis axis = AXIS_X) : axis(axis) {}
+
+    /**
+     * category is a single bit below 1 << MAX_CATEGORIES. a pair is reported
+     * when each box's mask has the other's category. userData is the
+     * caller's, usually an index into its own array
+     */
+    int add(const AABB& box, std::uint32_t category, std::uint32_t mask, int userData);
+    void remove(int proxy);
+    void move(int proxy, const AABB& box);
+    void clear();
+
+    int getUserData(int proxy) const { return proxies[proxy].userData; }
+    std::uint32_t getCategory(int proxy) const { return proxies[proxy].category; }
+
+    // sorts the endpoints again and appends every overlapping pair to pairs
+    void findPairs(std::vector<BroadphasePair>& pairs);
+
+    /**
+     * boxes moved a long way since the last findPairs(), the next one sorts
+     * from scratch instead of shifting endpoints one by one
+     */
+    void markUnsorted() { fullSort = true; }
+
+private:
+    struct Proxy
+    {
+        AABB box;
+        std::uint32_t category;
+        std::uint32_t mask;
+        int categorySlot; // index of the category bit
+        int userData;
+        int activeSlot; // position in its category's open list during a sweep
+        bool alive;
+        bool inList; // endpoints already in the sorted list
+    };
+
+    // proxy * 2, +1 for the max end
+    struct Endpoint
+    {
+        float value;
+        int code;
+    };
+
+    Axis axis;
+    std::vector<Proxy> proxies;
+    std::vector<int> freeProxies;
+    std::vector<Endpoint> endpoints;
+    std::vector<int> active[MAX_CATEGORIES];
+    bool removedSinceSweep = false;
+    bool fullSort = false;
+};
@@ -0,0 +1,51 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Runtime checks for the x86 vector extensions the
+ * simulation kernels can use. Kernels are compiled for the wider instruction
+ * sets with CPU_TARGET_* and only called when the check passes, so one
+ * binary runs on any x86-64 machine.
+ */
+#pragma once
+
+// sse2 is part of x86-64, 32-bit x86 only counts when built with it
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPU_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// msvc compiles any intrinsic without per-function targets
+#if defined(CPU_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CPU_TARGET_AVX __attribute__((target("avx")))
+#else
+#define CPU_TARGET_AVX
+#endif
+
+#if defined(CPU_X86) && defined(_MSC_VER)
+// os has to save the ymm registers too
+inline bool cpuOsSavesYmm()
+{
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    return osxsave && (_xgetbv(0) & 6) == 6;
+}
+#endif
+
+inline bool cpuHasAvx()
+{
+#if defined(CPU_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 28)) != 0 && cpuOsSavesYmm();
+#elif defined(CPU_X86)
+    return __builtin_cpu_supports("avx");
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,233 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Centipede head movement, path history, collision
+ * and splitting.
+ */
+#include "ECE_Centipede.h"
+
+#include <cmath>
+
+/**
+ * a centipede of count particles keeps count * PATH_SAMPLES path points,
+ * numbered 0 to capacity - 1 and reused in a circle. point p goes to ring
+ * p % PATH_SAMPLES at place p / PATH_SAMPLES, each ring counts its places
+ * down and is stored twice in a row. the points one particle after another
+ * reads are then neighbors in the same ring, in increasing order, and never
+ * wrap
+ */
+static int pathSlot(int count, int point)
+{
+    int ring = point % SegmentPool::PATH_SAMPLES;
+    int place = count - 1 - point / SegmentPool::PATH_SAMPLES;
+    return ring * 2 * count + place;
+}
+
+static void writePoint(SegmentPool& segments, int base, int count, int point, float x, float y)
+{
+    int slot = base + pathSlot(count, point);
+    segments.pathX[slot] = x;
+    segments.pathY[slot] = y;
+    segments.pathX[slot + count] = x;
+    segments.pathY[slot + count] = y;
+}
+
+// point in a circle of capacity points, point may be below zero
+static int wrapPoint(int point, int capacity)
+{
+    point %= capacity;
+    return point < 0 ? point + capacity : point;
+}
+
+ECE_Centipede::ECE_Centipede(SegmentPool& segments, const Vec2& headSize, const Vec2& bodySize,
+                             int numParticles, Vec2 startPosition, float speed)
+    : direction(-1.0f, 0.0f), speed(speed), headSize(headSize),
+      pointSpacing(bodySize.x / SegmentPool::PATH_SAMPLES), pointScale(1.0f / pointSpacing), pathDistance(0.0f)
+{
+    // with no width every path point lands on the head and recording the
+    // path never gets past the first one, so no chain is built
+    count = bodySize.x > 0.0f ? numParticles : 0;
+    alive = count > 0;
+    first = segments.allocate(count);
+
+    // head particle starts out moving to the left, body particles is
+    // following the head
+    for (int i = 0; i < count; ++i)
+    {
+        segments.x[first + i] = startPosition.x + i * bodySize.x;
+        segments.y[first + i] = startPosition.y;
+        segments.previousX[first + i] = segments.x[first + i];
+        segments.previousY[first + i] = segments.y[first + i];
+    }
+
+    // as if the head had walked in along the row, newest point last
+    int base = SegmentPool::pathBase(first);
+    int capacity = count * SegmentPool::PATH_SAMPLES;
+    for (int point = 0; point < capacity; ++point)
+    {
+        writePoint(segments, base, count, point, startPosition.x + (capacity - 1 - point) * pointSpacing,
+                   startPosition.y);
+    }
+    pathHead = capacity - 1;
+}
+
+ECE_Centipede::ECE_Centipede(int first, int count, Vec2 direction, float speed, const Vec2& headSize,
+                             float pointSpacing, float pathDistance)
+    : first(first), count(count), direction(direction), speed(speed), alive(count > 0), headSize(headSize),
+      pointSpacing(pointSpacing), pointScale(1.0f / pointSpacing), pathHead(0), pathDistance(pathDistance)
+{
+}
+
+int ECE_Centipede::pointsNeeded(int count)
+{
+    return count > 0 ? (count - 1) * SegmentPool::PATH_SAMPLES + 1 : 0;
+}
+
+ECE_Centipede ECE_Centipede::split(int index, SegmentPool& segments)
+{
+    int end = first + count;
+    int oldBase = SegmentPool::pathBase(first);
+    int oldCapacity = count * SegmentPool::PATH_SAMPLES;
+
+    // the particle behind the hit one becomes a head. it is where the old
+    // path was some spacings back, so it keeps the older part of the path
+    // and is the same distance past its newest point
+    int tailNewest = pathHead - (index + 1 - first) * SegmentPool::PATH_SAMPLES;
+
+    // it keeps going the way the path leads from there, which is not the
+    // head's way if the head turned since
+    Vec2 tailDirection = direction;
+    for (int point = tailNewest; point < pathHead; ++point)
+    {
+        int from = oldBase + pathSlot(count, wrapPoint(point, oldCapacity));
+        int to = oldBase + pathSlot(count, wrapPoint(point + 1, oldCapacity));
+        float step = segments.pathX[to] - segments.pathX[from];
+        if (step != 0.0f)
+        {
+            tailDirection = Vec2(step > 0.0f ? 1.0f : -1.0f, 0.0f);
+            break;
+        }
+    }
+
+    ECE_Centipede tail(index + 1, end - index - 1, tailDirection, speed, headSize, pointSpacing, pathDistance);
+    int frontCount = index - first;
+    int frontPoints = pointsNeeded(frontCount);
+    int tailPoints = pointsNeeded(tail.count);
+
+    // both parts get smaller rings in other places, so the points they
+    // keep are parked first
+    for (int i = 0; i < frontPoints; ++i)
+    {
+        int slot = oldBase + pathSlot(count, wrapPoint(pathHead - (frontPoints - 1) + i, oldCapacity));
+        segments.scratchX[i] = segments.pathX[slot];
+        segments.scratchY[i] = segments.pathY[slot];
+    }
+    for (int i = 0; i < tailPoints; ++i)
+    {
+        int slot = oldBase + pathSlot(count, wrapPoint(tailNewest - (tailPoints - 1) + i, oldCapacity));
+        segments.scratchX[frontPoints + i] = segments.pathX[slot];
+        segments.scratchY[frontPoints + i] = segments.pathY[slot];
+    }
+
+    // oldest is point 0, the hit particle's share of the path is dropped
+    int tailBase = SegmentPool::pathBase(tail.first);
+    for (int i = 0; i < frontPoints; ++i)
+    {
+        writePoint(segments, oldBase, frontCount, i, segments.scratchX[i], segments.scratchY[i]);
+    }
+    for (int i = 0; i < tailPoints; ++i)
+    {
+        writePoint(segments, tailBase, tail.count, i, segments.scratchX[frontPoints + i],
+                   segments.scratchY[frontPoints + i]);
+    }
+    pathHead = frontPoints - 1;
+    tail.pathHead = tailPoints - 1;
+
+    count = frontCount;
+    alive = count > 0;
+    return tail;
+}
+
+void ECE_Centipede::update(float deltaTime, SegmentPool& segments, const MushroomField& mushrooms)
+{
+    if (!alive) return;
+
+    float& headX = segments.x[first];
+    float& headY = segments.y[first];
+    float startX = headX;
+    float startY = headY;
+    headX += direction.x * speed * deltaTime; // move head
+    headY += direction.y * speed * deltaTime;
+
+    float leftBound = 0.0f;
+    float rightBound = WIDTH - headSize.x;
+
+    bool changeDirection = false;
+
+    // check screen edge collision
+    if (headX <= leftBound || headX >= rightBound)
+    {
+        changeDirection = true;
+    }
+
+    // check collision with mushroom, a navigation read per row the head covers
+    if (mushrooms.overlapsAny(AABB(headX, headY, headSize.x, headSize.y)))
+    {
+        changeDirection = true;
+    }
+
+    if (changeDirection)
+    {
+        direction.x = -direction.x; // change directions
+        headY += headSize.y; // move head down
+    }
+
+    // along the row, then the step down as a leg of its own, so the body
+    // goes down at the same spot and keeps its spacing along the path
+    recordPath(segments, startX, startY, headX, startY);
+    if (changeDirection)
+    {
+        recordPath(segments, headX, startY, headX, headY);
+    }
+    placeBody(segments);
+}
+
+// the head walked the straight line from start to end, which is along x or y
+void ECE_Centipede::recordPath(SegmentPool& segments, float startX, float startY, float endX, float endY)
+{
+    float distance = std::fabs(endX - startX) + std::fabs(endY - startY);
+    if (distance <= 0.0f) return;
+
+    int base = SegmentPool::pathBase(first);
+    int capacity = count * SegmentPool::PATH_SAMPLES;
+
+    // distance from start to the next point
+    float along = pointSpacing - pathDistance;
+    while (along <= distance)
+    {
+        float t = along / distance;
+        pathHead = (pathHead + 1 == capacity) ? 0 : pathHead + 1;
+        writePoint(segments, base, count, pathHead, startX + (endX - startX) * t, startY + (endY - startY) * t);
+        along += pointSpacing;
+    }
+    pathDistance = distance - (along - pointSpacing);
+}
+
+// particle k is PATH_SAMPLES * k points behind the newest one, blended
+// toward the next point by how far the head is past the newest. both
+// points move one place up the ring per particle
+void ECE_Centipede::placeBody(SegmentPool& segments) const
+{
+    if (count < 2) return;
+
+    int ring = pathHead % SegmentPool::PATH_SAMPLES;
+    int place = count - 1 - pathHead / SegmentPool::PATH_SAMPLES;
+    int base = SegmentPool::pathBase(first);
+
+    // slots particle 1 reads. the next point is in the next ring, or back
+    // at ring 0 one place on, which for particle 1 is the same place
+    int from = base + ring * 2 * count + place + 1;
+    int to = (ring + 1 < SegmentPool::PATH_SAMPLES) ? from + 2 * count : base + place;
+    segments.placeFromPath(first + 1, from, to, count - 1, pathDistance * pointScale);
+}
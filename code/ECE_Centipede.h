@@ -0,0 +1,111 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Centipede simulation state. The head walks the
+ * main area and turns on screen edges and mushrooms, the body particles
+ * follow the head. Particle positions live in a SegmentPool shared by all
+ * centipedes, a centipede only knows its range in the pool. Shooting a
+ * segment splits the range in two without moving any particle.
+ *
+ * The head drops a path point every body spacing / PATH_SAMPLES pixels it
+ * walks, into a ring in the pool. A turn's step down counts as walking, so
+ * the path has the same corner the head took. Body particle k is k
+ * spacings behind the head along that path, so it sits between two known
+ * points at the same fraction the head is past its newest point. Placing
+ * a particle is two reads and a blend, and the spacing along the path
+ * holds through every turn. Around a corner the straight line between two
+ * particles is shorter than the spacing.
+ */
+#pragma once
+
+#include "GameTypes.h"
+#include "MushroomField.h"
+#include "SegmentPool.h"
+
+/**
+ * constuctor takes a range of the pool and positions head and body.
+ * update moves the head, turns it on collisions and puts the body on the
+ * path behind it
+ */
+class ECE_Centipede
+{
+public:
+    // constructor, a body width of zero or less builds no chain and the
+    // centipede is not alive
+    ECE_Centipede(SegmentPool& segments, const Vec2& headSize, const Vec2& bodySize,
+                  int numParticles, Vec2 startPosition, float speed);
+
+    /**
+     * moves the head, turns it on screen edges and mushrooms and places the
+     * body. only touches this centipede's range of the pool, so different
+     * centipedes can update at the same time
+     */
+    void update(float deltaTime, SegmentPool& segments, const MushroomField& mushrooms);
+
+    /**
+     * kills the particle at index, which has to be in this centipede. this
+     * keeps the particles in front of it and the ones behind it are
+     * returned as a new centipede headed by the next particle. either part
+     * can end up with no particles and is then not alive
+     */
+    ECE_Centipede split(int index, SegmentPool& segments);
+
+    // check if centipede is alive
+    bool isAlive() const
+    {
+        return alive;
+    }
+
+    // particle range in the pool, the first one is the head
+    int getFirst() const
+    {
+        return first;
+    }
+
+    int getCount() const
+    {
+        return count;
+    }
+
+    const Vec2& getDirection() const
+    {
+        return direction;
+    }
+
+    // newest point of the path ring and how far the head is past it
+    int getPathHead() const
+    {
+        return pathHead;
+    }
+
+    float getPathDistance() const
+    {
+        return pathDistance;
+    }
+
+private:
+    // a range of particles that are already placed
+    ECE_Centipede(int first, int count, Vec2 direction, float speed, const Vec2& headSize, float pointSpacing,
+                  float pathDistance);
+
+    // adds the path points the head passed walking from start to end
+    void recordPath(SegmentPool& segments, float startX, float startY, float endX, float endY);
+    void placeBody(SegmentPool& segments) const;
+
+    // path points a range of count particles reads, newest first
+    static int pointsNeeded(int count);
+
+    int first;
+    int count;
+    Vec2 direction;
+    float speed;
+    bool alive;
+    Vec2 headSize;
+
+    // ring of count * PATH_SAMPLES points at the range's path base
+    float pointSpacing; // path length between two points
+    float pointScale; // 1 / pointSpacing
+    int pathHead; // slot of the newest point
+    float pathDistance; // walked since the newest point
+};
@@ -0,0 +1,67 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Laser blast fired by the starship. Only the
+ * simulation state lives here, the front end draws it from a snapshot.
+ * Kept small and trivially copyable so a LaserPool can hold them in one
+ * flat array.
+ */
+#pragma once
+
+#include "GameTypes.h"
+
+/**
+ * ECE_LaserBlast class.
+ * initializes the position and speed.
+ * moves the laser upwards. collisions are found by GameWorld, which sweeps
+ * every laser with the same size
+ */
+class ECE_LaserBlast
+{
+public:
+    ECE_LaserBlast() = default;
+
+    ECE_LaserBlast(const Vec2& position, float speed)
+        : position(position), previousPosition(position), speed(speed)
+    {
+    }
+
+    // remembered for render interpolation
+    void savePrevious()
+    {
+        previousPosition = position;
+    }
+
+    void update(float deltaTime)
+    {
+        position.y -= speed * deltaTime; // laser going up
+    }
+
+    const Vec2& getPosition() const
+    {
+        return position;
+    }
+
+    const Vec2& getPreviousPosition() const
+    {
+        return previousPosition;
+    }
+
+    // broadphase box of this laser
+    int getProxy() const
+    {
+        return proxy;
+    }
+
+    void setProxy(int id)
+    {
+        proxy = id;
+    }
+
+private:
+    Vec2 position;
+    Vec2 previousPosition;
+    float speed = 0.0f;
+    int proxy = -1;
+};
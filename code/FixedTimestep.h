@@ -0,0 +1,54 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Accumulator for running the simulation at a
+ * fixed tick rate regardless of the frame rate. Frame time goes in, the
+ * number of ticks to run comes out, and the leftover fraction of a tick is
+ * used to interpolate between the last two simulation states when drawing.
+ */
+#pragma once
+
+/**
+ * after a long frame at most maxTicksPerFrame ticks are run and the rest of
+ * the backlog is dropped, so one hitch cannot snowball into the next frame
+ */
+class FixedTimestep
+{
+public:
+    explicit FixedTimestep(float tickRate = 120.0f, int maxTicksPerFrame = 8)
+        : tickDelta(1.0f / tickRate), maxTicksPerFrame(maxTicksPerFrame), accumulator(0.0f)
+    {
+    }
+
+    // adds the frame time, returns how many ticks to run now
+    int advance(float frameTime)
+    {
+        accumulator += frameTime;
+
+        int ticks = static_cast<int>(accumulator / tickDelta);
+        if (ticks > maxTicksPerFrame)
+        {
+            ticks = maxTicksPerFrame;
+            accumulator = ticks * tickDelta;
+        }
+        accumulator -= ticks * tickDelta;
+        return ticks;
+    }
+
+    float getTickDelta() const
+    {
+        return tickDelta;
+    }
+
+    // 0 right at the last tick, approaching 1 just before the next one
+    float getAlpha() const
+    {
+        return accumulator / tickDelta;
+    }
+
+private:
+    float tickDelta;
+    int maxTicksPerFrame;
+    float accumulator;
+};
@@ -0,0 +1,53 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: The files the game loads and the names they go
+ * by, shared by the game and the pack_assets tool so a pack always holds
+ * what the game asks for.
+ */
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+struct AssetFile
+{
+    const char* name;
+    const char* path;
+};
+
+// atlas regions, the laser is generated and added by makeLaserImage()
+static const AssetFile SPRITE_FILES[] = {
+    {"background", "graphics/Background.png"}, // start screen
+    {"mushroom0", "graphics/Mushroom0.png"},
+    {"mushroom1", "graphics/Mushroom1.png"},
+    {"starship", "graphics/StarShip.png"},
+    {"spider", "graphics/spider.png"},
+    {"centipedeHead", "graphics/CentipedeHead.png"},
+    {"centipedeBody", "graphics/CentipedeBody.png"}
+};
+static const int SPRITE_FILE_COUNT = sizeof(SPRITE_FILES) / sizeof(SPRITE_FILES[0]);
+
+static const AssetFile SOUND_FILES[] = {
+    {"chop", "sound/chop.wav"},
+    {"death", "sound/death.wav"},
+    {"outOfTime", "sound/out_of_time.wav"}
+};
+static const int SOUND_FILE_COUNT = sizeof(SOUND_FILES) / sizeof(SOUND_FILES[0]);
+
+static const AssetFile FONT_FILE = {"font", "fonts/KOMIKAP_.ttf"};
+
+// score digits are baked at this size
+static const unsigned int SCORE_CHARACTER_SIZE = 36;
+static const char* const SCORE_DIGITS_NAME = "scoreDigits";
+
+static const char* const ATLAS_NAME = "atlas";
+static const char* const LASER_NAME = "laser";
+
+// red laser
+inline sf::Image makeLaserImage()
+{
+    sf::Image laser;
+    laser.create(2, 15, sf::Color::Red);
+    return laser;
+}
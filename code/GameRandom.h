@@ -0,0 +1,74 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Seedable random numbers for the simulation.
+ * std::uniform_int_distribution is implemented differently by every
+ * standard library, so a recorded session would not replay the same on
+ * another compiler. This is a PCG32 generator with fixed range mapping, so
+ * one seed gives the same game everywhere.
+ */
+#pragma once
+
+#include <cstdint>
+
+class GameRandom
+{
+public:
+    explicit GameRandom(std::uint64_t seed = 0)
+    {
+        this->seed(seed);
+    }
+
+    void seed(std::uint64_t value)
+    {
+        state = 0;
+        next();
+        state += value;
+        next();
+    }
+
+    std::uint32_t next()
+    {
+        std::uint64_t old = state;
+        state = old * 6364136223846793005ULL + INCREMENT;
+        std::uint32_t xorShifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        std::uint32_t rotation = static_cast<std::uint32_t>(old >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+    }
+
+    // uniform in [low, high], both ends included
+    int nextInt(int low, int high)
+    {
+        if (high <= low) return low;
+
+        // reject the top sliver so every value is equally likely
+        std::uint32_t range = static_cast<std::uint32_t>(high - low) + 1;
+        std::uint32_t threshold = (0u - range) % range;
+        for (;;)
+        {
+            std::uint32_t r = next();
+            if (r >= threshold)
+            {
+                return low + static_cast<int>(r % range);
+            }
+        }
+    }
+
+    // uniform in [low, high)
+    float nextFloat(float low, float high)
+    {
+        float unit = (next() >> 8) * (1.0f / 16777216.0f);
+        return low + (high - low) * unit;
+    }
+
+    std::uint64_t getState() const
+    {
+        return state;
+    }
+
+private:
+    static const std::uint64_t INCREMENT = 1442695040888963407ULL;
+
+    std::uint64_t state;
+};
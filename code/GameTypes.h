@@ -0,0 +1,79 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Shared constants and small math types used by the
+ * simulation core. Nothing in here depends on SFML so the game logic can be
+ * built and run without a window.
+ */
+#pragma once
+
+// dividing the top info area, main game area, and mushroom free area
+const int WIDTH = 800;
+const int HEIGHT = 600;
+const int TOP_AREA_HEIGHT = 50;
+const int BOTTOM_AREA_HEIGHT = 50;
+const int MAIN_AREA_HEIGHT = HEIGHT - TOP_AREA_HEIGHT - BOTTOM_AREA_HEIGHT;
+
+/**
+ * 2d vector in pixels
+ */
+struct Vec2
+{
+    float x = 0.0f;
+    float y = 0.0f;
+
+    Vec2() = default;
+    Vec2(float x, float y) : x(x), y(y) {}
+
+    Vec2 operator+(const Vec2& other) const { return Vec2(x + other.x, y + other.y); }
+    Vec2 operator-(const Vec2& other) const { return Vec2(x - other.x, y - other.y); }
+    Vec2 operator*(float s) const { return Vec2(x * s, y * s); }
+    Vec2& operator+=(const Vec2& other) { x += other.x; y += other.y; return *this; }
+};
+
+// linear blend, t = 0 gives a and t = 1 gives b
+inline Vec2 lerp(const Vec2& a, const Vec2& b, float t)
+{
+    return Vec2(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+}
+
+/**
+ * axis aligned box. intersects() matches sf::FloatRect::intersects so
+ * touching edges do not count as a collision
+ */
+struct AABB
+{
+    float left = 0.0f;
+    float top = 0.0f;
+    float width = 0.0f;
+    float height = 0.0f;
+
+    AABB() = default;
+    AABB(float left, float top, float width, float height)
+        : left(left), top(top), width(width), height(height) {}
+    AABB(const Vec2& position, const Vec2& size)
+        : left(position.x), top(position.y), width(size.x), height(size.y) {}
+
+    float right() const { return left + width; }
+    float bottom() const { return top + height; }
+
+    // everything the box covers while it moves by motion
+    AABB swept(const Vec2& motion) const
+    {
+        float sweptLeft = motion.x < 0.0f ? left + motion.x : left;
+        float sweptTop = motion.y < 0.0f ? top + motion.y : top;
+        float sweptWidth = width + (motion.x < 0.0f ? -motion.x : motion.x);
+        float sweptHeight = height + (motion.y < 0.0f ? -motion.y : motion.y);
+        return AABB(sweptLeft, sweptTop, sweptWidth, sweptHeight);
+    }
+
+    bool intersects(const AABB& other) const
+    {
+        float interLeft = left > other.left ? left : other.left;
+        float interTop = top > other.top ? top : other.top;
+        float interRight = right() < other.right() ? right() : other.right();
+        float interBottom = bottom() < other.bottom() ? bottom() : other.bottom();
+        return interLeft < interRight && interTop < interBottom;
+    }
+};
@@ -0,0 +1,785 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Game rules for the headless simulation core.
+ */
+#include "GameWorld.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "PerfStats.h"
+#include "TaskScheduler.h"
+#include "Trace.h"
+
+const char* const WORLD_PHASE_NAMES[PHASE_COUNT] = {
+    "starship", "lasers", "laser hits", "spider", "centipedes"
+};
+
+// one mushroom per tile, the tiles cover the main area and are centered horizontally
+static MushroomField makeField(const Vec2& tileSize)
+{
+    int columns = static_cast<int>(WIDTH / tileSize.x);
+    int rows = static_cast<int>(MAIN_AREA_HEIGHT / tileSize.y);
+    float left = std::floor((WIDTH - columns * tileSize.x) / 2.0f);
+    return MushroomField(Vec2(left, TOP_AREA_HEIGHT), tileSize, columns, rows);
+}
+
+GameWorld::GameWorld(const WorldConfig& config)
+    : config(config), mushrooms(makeField(config.mushroomSize)), shootLaser(config.maxLasers),
+      broadphase(Broadphase::AXIS_Y)
+{
+    events.reserve(MAX_EVENTS);
+    reset(0);
+}
+
+void GameWorld::reset(std::uint32_t seed)
+{
+    gen.seed(seed);
+
+    // starting position middle bottom
+    starshipStartPosition = Vec2((WIDTH - config.starshipSize.x) / 2.0f,
+                                 HEIGHT - BOTTOM_AREA_HEIGHT - config.starshipSize.y);
+
+    // spider starting position
+    spiderStartPosition = Vec2(WIDTH / 2.0f, TOP_AREA_HEIGHT + MAIN_AREA_HEIGHT / 2.0f);
+    spiderDirection = Vec2(1.0f, 0.0f);
+    spiderChangeDirectionTime = 0.0f;
+
+    restart();
+}
+
+// broadphase categories, lasers collide with the spider and segments
+static const std::uint32_t CATEGORY_LASER = 1;
+static const std::uint32_t CATEGORY_SPIDER = 2;
+static const std::uint32_t CATEGORY_SEGMENT = 4;
+
+// back to the start screen with a new field, same as losing the last life
+void GameWorld::restart()
+{
+    gameStarted = false;
+    score = 0;
+    lives = config.startLives;
+
+    starshipPosition = starshipStartPosition;
+    spiderPosition = spiderStartPosition;
+    spiderActive = true;
+    spiderRespawnTimer = 0.0f;
+
+    spawnMushrooms();
+    shootLaser.clear();
+    broadphase.clear();
+    spiderProxy = broadphase.add(AABB(spiderPosition, config.spiderSize), CATEGORY_SPIDER, CATEGORY_LASER, 0);
+    spawnCentipede();
+    savePrevious();
+}
+
+// positions at the start of a tick, the renderer blends from these
+void GameWorld::savePrevious()
+{
+    starshipPrevious = starshipPosition;
+    spiderPrevious = spiderPosition;
+    for (auto& laser : shootLaser)
+    {
+        laser.savePrevious();
+    }
+    segments.savePrevious();
+}
+
+void GameWorld::spawnMushrooms()
+{
+    //mushroom placement rows are set in the main game area, clear of the starship
+    const TileLayout& layout = mushrooms.getLayout();
+    float mushroomBottomLimit = HEIGHT - BOTTOM_AREA_HEIGHT - 2 * layout.tileSize.y;
+    int spawnRows = std::min(static_cast<int>((mushroomBottomLimit - layout.origin.y) / layout.tileSize.y), layout.rows);
+
+    mushrooms.scatter(config.mushroomCount, spawnRows, gen);
+}
+
+void GameWorld::spawnCentipede()
+{
+    segments.clear();
+    centipedes.clear();
+
+    // every split adds a centipede of at least one particle, so this many
+    // never have to grow the vector during a wave
+    centipedes.reserve(config.centipedeCount * config.centipedeLength);
+
+    // set starting position at the right corner of top info area, extra
+    // centipedes start one row further down each
+    for (int i = 0; i < config.centipedeCount; ++i)
+    {
+        Vec2 centipedeStartPosition(WIDTH - config.headSize.x,
+                                    TOP_AREA_HEIGHT + (i % (MAIN_AREA_HEIGHT / static_cast<int>(config.headSize.y))) * config.headSize.y);
+        centipedes.push_back(ECE_Centipede(segments, config.headSize, config.bodySize, config.centipedeLength,
+                                           centipedeStartPosition, config.centipedeSpeed));
+    }
+
+    segmentProxies.resize(segments.size());
+    for (int i = 0; i < segments.size(); ++i)
+    {
+        segmentProxies[i] = broadphase.add(AABB(), CATEGORY_SEGMENT, CATEGORY_LASER, i);
+    }
+}
+
+// laser position is at the tip of the starship
+void GameWorld::fireLaser()
+{
+    Vec2 laserPosition(
+        starshipPosition.x + config.starshipSize.x / 2.0f - config.laserSize.x / 2.0f,
+        starshipPosition.y - config.laserSize.y
+    );
+    if (shootLaser.spawn(laserPosition, config.laserSpeed))
+    {
+        // the laser keeps its proxy, so removal moving it to another slot is fine
+        ECE_LaserBlast& laser = shootLaser[shootLaser.size() - 1];
+        laser.setProxy(broadphase.add(AABB(laserPosition, config.laserSize), CATEGORY_LASER,
+                                      CATEGORY_SEGMENT | CATEGORY_SPIDER, 0));
+    }
+}
+
+void GameWorld::step(float deltaTime, const InputFrame& input)
+{
+    TRACE_ZONE("step");
+    savePrevious();
+    events.clear();
+
+    if (input.start)
+    {
+        gameStarted = true; // start game on enter
+    }
+    if (gameStarted && input.fire)
+    {
+        fireLaser();
+    }
+
+    if (!gameStarted)
+    {
+        return;
+    }
+
+    updateStarship(deltaTime, input);
+    updateLasers(deltaTime);
+    collideLasers();
+
+    // game ends when every centipede particle is shot
+    if (centipedes.empty())
+    {
+        emit(EVENT_GAME_OVER, starshipPosition);
+        restart();
+        return;
+    }
+
+    updateSpider(deltaTime);
+
+    // spider may have taken the last life
+    if (!gameStarted)
+    {
+        return;
+    }
+
+    // update centipedes
+    TRACE_ZONE("centipedes");
+    PhaseTimer timer(phaseTiming, phaseSeconds[PHASE_CENTIPEDES]);
+    if (scheduler != nullptr && static_cast<int>(centipedes.size()) >= PARALLEL_CENTIPEDES)
+    {
+        // a chain only writes its own head, direction, segment range and
+        // path ring and only reads the mushrooms, so chains can run anywhere
+        // in any order and the result is the same as the serial pass
+        scheduler->parallelFor(static_cast<int>(centipedes.size()), CENTIPEDE_GRAIN,
+            [&](int begin, int end)
+            {
+                for (int c = begin; c < end; ++c)
+                {
+                    centipedes[c].update(deltaTime, segments, mushrooms);
+                }
+            });
+        return;
+    }
+
+    for (auto& centipede : centipedes)
+    {
+        centipede.update(deltaTime, segments, mushrooms);
+    }
+}
+
+void GameWorld::takePhaseTimes(double (&seconds)[PHASE_COUNT])
+{
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        seconds[phase] = phaseSeconds[phase];
+        phaseSeconds[phase] = 0.0;
+    }
+}
+
+int GameWorld::getSegmentCount() const
+{
+    int count = 0;
+    for (const auto& centipede : centipedes)
+    {
+        count += centipede.getCount();
+    }
+    return count;
+}
+
+void GameWorld::updateStarship(float deltaTime, const InputFrame& input)
+{
+    TRACE_ZONE("starship");
+    PhaseTimer timer(phaseTiming, phaseSeconds[PHASE_STARSHIP]);
+    // starship movement with left, right, up, down key
+    float moveX = 0.0f;
+    float moveY = 0.0f;
+    if (input.left)
+    {
+        moveX -= config.starshipSpeed * deltaTime;
+    }
+    if (input.right)
+    {
+        moveX += config.starshipSpeed * deltaTime;
+    }
+    if (input.up)
+    {
+        moveY -= config.starshipSpeed * deltaTime;
+    }
+    if (input.down)
+    {
+        moveY += config.starshipSpeed * deltaTime;
+    }
+
+    Vec2 position = starshipPosition;
+
+    // boundaries for starship
+    float leftBound = 0.0f;
+    float rightBound = WIDTH - config.starshipSize.x;
+    float lowerBound = HEIGHT - BOTTOM_AREA_HEIGHT - config.starshipSize.y;
+    float upperBound = lowerBound - (MAIN_AREA_HEIGHT * 0.25f);
+
+    // collision on x
+    AABB starshipBounds(position, config.starshipSize);
+    starshipBounds.left = position.x + moveX;
+
+    bool collisionX = mushrooms.overlapsAny(starshipBounds);
+
+    if (!collisionX)
+    {
+        position.x += moveX;
+    }
+
+    // collision on y
+    starshipBounds.top = position.y + moveY;
+
+    bool collisionY = mushrooms.overlapsAny(starshipBounds);
+
+    if (!collisionY)
+    {
+        position.y += moveY;
+    }
+
+    // boundaries set at .25 from the bottom
+    if (position.x < leftBound)
+    {
+        position.x = leftBound;
+    }
+    if (position.x > rightBound)
+    {
+        position.x = rightBound;
+    }
+    if (position.y < upperBound)
+    {
+        position.y = upperBound;
+    }
+    if (position.y > lowerBound)
+    {
+        position.y = lowerBound;
+    }
+    starshipPosition = position;
+}
+
+// update laser blasts, the ones out of bounds go after the collision test
+void GameWorld::updateLasers(float deltaTime)
+{
+    TRACE_ZONE("lasers");
+    PhaseTimer timer(phaseTiming, phaseSeconds[PHASE_LASERS]);
+    for (int i = 0; i < shootLaser.size(); ++i)
+    {
+        shootLaser[i].update(deltaTime);
+    }
+}
+
+// boxes to this tick's positions and the candidate pairs, grouped by laser
+void GameWorld::updateBroadphase(const AABB& spiderBounds)
+{
+    for (int i = 0; i < shootLaser.size(); ++i)
+    {
+        const ECE_LaserBlast& laser = shootLaser[i];
+        AABB startBounds(laser.getPreviousPosition(), config.laserSize);
+        broadphase.move(laser.getProxy(), startBounds.swept(laser.getPosition() - laser.getPreviousPosition()));
+    }
+    broadphase.move(spiderProxy, spiderBounds);
+
+    // heads and bodies differ in size, the box fits either
+    Vec2 segmentSize(std::max(config.headSize.x, config.bodySize.x), std::max(config.headSize.y, config.bodySize.y));
+    for (const auto& centipede : centipedes)
+    {
+        for (int i = centipede.getFirst(); i < centipede.getFirst() + centipede.getCount(); ++i)
+        {
+            broadphase.move(segmentProxies[i], AABB(segments.x[i], segments.y[i], segmentSize.x, segmentSize.y));
+        }
+    }
+
+    // the other paths ran in between, the boxes may have moved far
+    if (broadphaseStale)
+    {
+        broadphase.markUnsorted();
+        broadphaseStale = false;
+    }
+    pairs.clear();
+    broadphase.findPairs(pairs);
+
+    laserPairs.clear();
+    for (const BroadphasePair& pair : pairs)
+    {
+        if (broadphase.getCategory(pair.first) == CATEGORY_LASER)
+        {
+            laserPairs.push_back(pair);
+        } else
+        {
+            laserPairs.push_back({pair.second, pair.first});
+        }
+    }
+    std::sort(laserPairs.begin(), laserPairs.end(), [](const BroadphasePair& a, const BroadphasePair& b)
+    {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    });
+}
+
+// every live segment's box, big enough for a head or a body
+void GameWorld::packSegments()
+{
+    Vec2 segmentSize(std::max(config.headSize.x, config.bodySize.x), std::max(config.headSize.y, config.bodySize.y));
+    segmentBoxes.clear();
+    segmentSlots.clear();
+    for (const auto& centipede : centipedes)
+    {
+        for (int i = centipede.getFirst(); i < centipede.getFirst() + centipede.getCount(); ++i)
+        {
+            segmentBoxes.add(AABB(segments.x[i], segments.y[i], segmentSize.x, segmentSize.y));
+            segmentSlots.push_back(i);
+        }
+    }
+}
+
+// laser hitting mushroom, centipede and spider. each laser is tested over
+// the whole path it moved this tick, so a long tick cannot carry it past a
+// target. the vector kernel or the broadphase narrows centipede segments
+// and the spider down to the few whose boxes the path touches
+void GameWorld::collideLasers()
+{
+    TRACE_ZONE("laserCollision");
+    PhaseTimer timer(phaseTiming, phaseSeconds[PHASE_LASER_COLLISION]);
+    AABB spiderBounds(spiderPosition, config.spiderSize);
+
+    // only lasers collide with anything here, with none in flight the
+    // boxes can wait until the next shot
+    if (shootLaser.size() == 0) return;
+
+    CollisionPath path = collisionPath;
+    if (path == COLLISION_AUTO)
+    {
+        path = shootLaser.size() < BATCH_LASERS ? COLLISION_DIRECT : COLLISION_BATCH;
+    }
+    bool direct = path == COLLISION_DIRECT;
+    bool batched = path == COLLISION_BATCH;
+    if (direct || batched)
+    {
+        broadphaseStale = true;
+    } else
+    {
+        updateBroadphase(spiderBounds);
+    }
+    if (batched)
+    {
+        packSegments();
+    }
+
+    for (int i = 0; i < shootLaser.size();)
+    {
+        const ECE_LaserBlast& laser = shootLaser[i];
+        AABB startBounds(laser.getPreviousPosition(), config.laserSize);
+        Vec2 motion = laser.getPosition() - laser.getPreviousPosition();
+
+        // the first mushroom on the path stops the laser, anything before it is hit instead
+        float hitTime = 1.0f;
+        int hit = mushrooms.sweep(startBounds, motion, hitTime);
+        AABB laserPath = startBounds.swept(motion * (hit >= 0 ? hitTime : 1.0f));
+
+        // among the candidates the first centipede in order is hit, at its
+        // first touched particle. earlier hits this tick may have split
+        // chains or killed segments, so both are looked up now
+        int hitChain = -1;
+        int hitSegment = -1;
+        bool spiderHit = false;
+        laserTargets.clear();
+        if (direct)
+        {
+            findSegmentHit(laserPath, hitChain, hitSegment);
+            spiderHit = spiderActive && laserPath.intersects(spiderBounds);
+        } else if (batched)
+        {
+            segmentBoxes.forEachHit(laserPath, [&](int slot)
+            {
+                laserTargets.push_back(segmentSlots[slot]);
+            });
+            spiderHit = spiderActive && laserPath.intersects(spiderBounds);
+        } else
+        {
+            auto candidates = std::equal_range(laserPairs.begin(), laserPairs.end(),
+                BroadphasePair{laser.getProxy(), 0}, [](const BroadphasePair& a, const BroadphasePair& b)
+                {
+                    return a.first < b.first;
+                });
+            for (auto candidate = candidates.first; candidate != candidates.second; ++candidate)
+            {
+                if (candidate->second == spiderProxy)
+                {
+                    spiderHit = spiderActive && laserPath.intersects(spiderBounds);
+                } else
+                {
+                    laserTargets.push_back(broadphase.getUserData(candidate->second));
+                }
+            }
+        }
+
+        for (int segment : laserTargets)
+        {
+            int chain = chainOf(segment);
+            if (chain < 0) continue;
+
+            const Vec2& size = (segment == centipedes[chain].getFirst()) ? config.headSize : config.bodySize;
+            if (!laserPath.intersects(AABB(segments.x[segment], segments.y[segment], size.x, size.y))) continue;
+
+            if (hitChain < 0 || chain < hitChain || (chain == hitChain && segment < hitSegment))
+            {
+                hitChain = chain;
+                hitSegment = segment;
+            }
+        }
+
+        if (hitChain >= 0)
+        {
+            shootSegment(hitChain, hitSegment);
+            removeLaser(i);
+        } else if (spiderHit)
+        {
+            // spider collision
+            spiderActive = false; // remove spider
+            spiderRespawnTimer = 0.0f;
+            score += 500; // killing the spider is 500 points
+            emit(EVENT_SPIDER_KILLED, spiderPosition);
+
+            // erase laser after hitting
+            removeLaser(i);
+        } else if (hit >= 0)
+        {
+            Vec2 contact = laser.getPreviousPosition() + motion * hitTime;
+            emit(EVENT_MUSHROOM_HIT, contact);
+
+            // to mushroom1, if mushroom1 is hit again then it is gone
+            if (mushrooms.hit(hit) == 0)
+            {
+                score += 4; // killing mushroom is 4 points
+            }
+
+            // erase laser after hitting
+            removeLaser(i);
+        } else if (laser.getPosition().y + config.laserSize.y < 0)
+        {
+            removeLaser(i); // the last laser is in i now
+        } else
+        {
+            ++i;
+        }
+    }
+}
+
+void GameWorld::removeLaser(int index)
+{
+    broadphase.remove(shootLaser[index].getProxy());
+    shootLaser.remove(index);
+}
+
+// first particle of the first centipede the laser path touches, every live
+// segment is tested
+void GameWorld::findSegmentHit(const AABB& laserPath, int& hitChain, int& hitSegment) const
+{
+    for (size_t c = 0; c < centipedes.size(); ++c)
+    {
+        int first = centipedes[c].getFirst();
+        int end = first + centipedes[c].getCount();
+        for (int i = first; i < end; ++i)
+        {
+            const Vec2& size = (i == first) ? config.headSize : config.bodySize;
+            if (!laserPath.intersects(AABB(segments.x[i], segments.y[i], size.x, size.y))) continue;
+
+            hitChain = static_cast<int>(c);
+            hitSegment = i;
+            return;
+        }
+    }
+}
+
+// centipede holding the segment, -1 once it was shot
+int GameWorld::chainOf(int segment) const
+{
+    for (size_t c = 0; c < centipedes.size(); ++c)
+    {
+        int first = centipedes[c].getFirst();
+        if (segment >= first && segment < first + centipedes[c].getCount())
+        {
+            return static_cast<int>(c);
+        }
+    }
+    return -1;
+}
+
+// splits the centipede at the hit particle, a mushroom grows where it was
+void GameWorld::shootSegment(int c, int i)
+{
+    int first = centipedes[c].getFirst();
+    const Vec2& size = (i == first) ? config.headSize : config.bodySize;
+
+    score += (i == first) ? 100 : 10; // head is 100 points, body is 10
+    emit(EVENT_CENTIPEDE_HIT, Vec2(segments.x[i], segments.y[i]));
+
+    int cell = mushrooms.cellAt(segments.x[i] + size.x / 2.0f, segments.y[i] + size.y / 2.0f);
+    if (cell >= 0)
+    {
+        mushrooms.place(cell);
+    }
+
+    // the hit particle leaves every chain
+    broadphase.remove(segmentProxies[i]);
+    segmentProxies[i] = -1;
+
+    // the rear part takes the slot of the front part if that is gone,
+    // the vector was reserved for the most centipedes a wave can have
+    ECE_Centipede tail = centipedes[c].split(i, segments);
+    if (!centipedes[c].isAlive())
+    {
+        centipedes[c] = tail;
+    } else if (tail.isAlive())
+    {
+        centipedes.push_back(tail);
+    }
+    if (!centipedes[c].isAlive())
+    {
+        centipedes[c] = centipedes.back();
+        centipedes.pop_back();
+    }
+}
+
+void GameWorld::updateSpider(float deltaTime)
+{
+    TRACE_ZONE("spider");
+    PhaseTimer timer(phaseTiming, phaseSeconds[PHASE_SPIDER]);
+    if (!spiderActive)
+    {
+        // reset spider at random position
+        spiderRespawnTimer += deltaTime;
+        if (spiderRespawnTimer >= config.spiderRespawnInterval)
+        {
+            spiderActive = true; // respawn
+            spiderRespawnTimer = 0.0f;
+            float newSpiderX = static_cast<float>(gen.nextInt(0, WIDTH - static_cast<int>(config.spiderSize.x)));
+            float newSpiderY = static_cast<float>(gen.nextInt(TOP_AREA_HEIGHT, TOP_AREA_HEIGHT + MAIN_AREA_HEIGHT - static_cast<int>(config.spiderSize.y)));
+            spiderPosition = Vec2(newSpiderX, newSpiderY);
+            spiderPrevious = spiderPosition; // no blending across the screen
+        }
+        return;
+    }
+
+    spiderChangeDirectionTime += deltaTime;
+
+    if (spiderChangeDirectionTime >= config.spiderDirectionChangeInterval)
+    {
+        spiderChangeDirectionTime = 0.0f;
+        // random direction
+        float dirX = gen.nextFloat(-1.0f, 1.0f);
+        float dirY = gen.nextFloat(-1.0f, 1.0f);
+        // normalize vector
+        float magnitude = std::sqrt(dirX * dirX + dirY * dirY);
+        if (magnitude != 0) {
+            spiderDirection.x = dirX / magnitude;
+            spiderDirection.y = dirY / magnitude;
+        }
+    }
+    spiderPosition += spiderDirection * (config.spiderSpeed * deltaTime); // spider movement
+
+    // spider boundaries
+    float spiderLeftBound = 0.0f;
+    float spiderRightBound = WIDTH - config.spiderSize.x;
+    float spiderUpperBound = TOP_AREA_HEIGHT;
+    float spiderLowerBound = TOP_AREA_HEIGHT + MAIN_AREA_HEIGHT - config.spiderSize.y;
+
+    if (spiderPosition.x < spiderLeftBound)
+    {
+        spiderPosition.x = spiderLeftBound;
+        spiderDirection.x = -spiderDirection.x;
+    }
+    if (spiderPosition.x > spiderRightBound)
+    {
+        spiderPosition.x = spiderRightBound;
+        spiderDirection.x = -spiderDirection.x;
+    }
+    if (spiderPosition.y < spiderUpperBound)
+    {
+        spiderPosition.y = spiderUpperBound;
+        spiderDirection.y = -spiderDirection.y;
+    }
+    if (spiderPosition.y > spiderLowerBound)
+    {
+        spiderPosition.y = spiderLowerBound;
+        spiderDirection.y = -spiderDirection.y;
+    }
+
+    AABB spiderBounds(spiderPosition, config.spiderSize);
+
+    // when spider hits mushroom, mushroom is removed
+    mushrooms.forEachOverlap(spiderBounds, [&](int cell)
+    {
+        mushrooms.destroy(cell);
+    });
+
+    // when spider hits starship
+    if (spiderBounds.intersects(AABB(starshipPosition, config.starshipSize)))
+    {
+        emit(lives > 1 ? EVENT_PLAYER_DIED : EVENT_GAME_OVER, starshipPosition);
+
+        // starship starts again at the starting position
+        starshipPosition = starshipStartPosition;
+        starshipPrevious = starshipPosition;
+        lives--; // lose one life
+
+        // when all lives are used reset
+        if (lives == 0)
+        {
+            restart();
+        }
+    }
+}
+
+void GameWorld::emit(GameEventType type, const Vec2& position)
+{
+    if (static_cast<int>(events.size()) < MAX_EVENTS)
+    {
+        events.push_back({type, position});
+    }
+}
+
+void GameWorld::snapshot(WorldSnapshot& out) const
+{
+    out.mushroomLayout = mushrooms.getLayout();
+    out.mushroomTiles = mushrooms.getTiles();
+
+    out.segments.clear();
+    for (const auto& centipede : centipedes)
+    {
+        if (!centipede.isAlive()) continue;
+
+        int first = centipede.getFirst();
+        for (int i = first; i < first + centipede.getCount(); ++i)
+        {
+            out.segments.push_back({Vec2(segments.x[i], segments.y[i]),
+                                    Vec2(segments.previousX[i], segments.previousY[i]),
+                                    i == first});
+        }
+    }
+
+    out.lasers.clear();
+    for (const auto& laser : shootLaser)
+    {
+        out.lasers.push_back({laser.getPosition(), laser.getPreviousPosition()});
+    }
+
+    out.starship = starshipPosition;
+    out.starshipPrevious = starshipPrevious;
+    out.spider = spiderPosition;
+    out.spiderPrevious = spiderPrevious;
+    out.spiderActive = spiderActive;
+    out.started = gameStarted;
+    out.score = score;
+    out.lives = lives;
+}
+
+// fnv-1a, floats are hashed by their bits
+static void hashBytes(std::uint64_t& hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+}
+
+static void hashValue(std::uint64_t& hash, float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, 4);
+    hashBytes(hash, &bits, 4);
+}
+
+static void hashValue(std::uint64_t& hash, std::int32_t value)
+{
+    hashBytes(hash, &value, 4);
+}
+
+static void hashValue(std::uint64_t& hash, const Vec2& value)
+{
+    hashValue(hash, value.x);
+    hashValue(hash, value.y);
+}
+
+// covers everything that affects the next step
+std::uint64_t GameWorld::checksum() const
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    std::uint64_t rngState = gen.getState();
+    hashBytes(hash, &rngState, sizeof(rngState));
+    hashValue(hash, gameStarted ? 1 : 0);
+    hashValue(hash, score);
+    hashValue(hash, lives);
+
+    const std::vector<std::uint8_t>& tiles = mushrooms.getTiles();
+    hashBytes(hash, tiles.data(), tiles.size());
+
+    for (const auto& centipede : centipedes)
+    {
+        hashValue(hash, centipede.getFirst());
+        hashValue(hash, centipede.getCount());
+        hashValue(hash, centipede.getDirection());
+        hashValue(hash, centipede.getPathHead());
+        hashValue(hash, centipede.getPathDistance());
+    }
+    for (int i = 0; i < segments.size(); ++i)
+    {
+        hashValue(hash, Vec2(segments.x[i], segments.y[i]));
+    }
+
+    // the body is placed from the path rings
+    hashBytes(hash, segments.pathX.data(), segments.pathX.size() * sizeof(float));
+    hashBytes(hash, segments.pathY.data(), segments.pathY.size() * sizeof(float));
+    for (const auto& laser : shootLaser)
+    {
+        hashValue(hash, laser.getPosition());
+    }
+
+    hashValue(hash, starshipPosition);
+    hashValue(hash, spiderPosition);
+    hashValue(hash, spiderDirection);
+    hashValue(hash, spiderChangeDirectionTime);
+    hashValue(hash, spiderActive ? 1 : 0);
+    hashValue(hash, spiderRespawnTimer);
+    return hash;
+}
@@ -0,0 +1,274 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Headless simulation core. GameWorld owns the
+ * mushrooms, centipedes, lasers, spider, starship, score and lives and
+ * advances them with step(). It never touches a window, so it can run as
+ * fast as the CPU allows for benchmarks, soak tests and batch runs. The
+ * SFML front end in lab1.cpp feeds it an InputFrame and draws a snapshot.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BoxBatch.h"
+#include "Broadphase.h"
+#include "ECE_Centipede.h"
+#include "GameRandom.h"
+#include "GameTypes.h"
+#include "LaserPool.h"
+#include "MushroomField.h"
+#include "SegmentPool.h"
+
+class TaskScheduler;
+
+/**
+ * input sampled for one step. fire and start are key presses that happened
+ * since the last step, the arrows are held keys
+ */
+struct InputFrame
+{
+    bool left = false;
+    bool right = false;
+    bool up = false;
+    bool down = false;
+    bool fire = false;
+    bool start = false;
+};
+
+/**
+ * sprite sizes and tuning. the defaults match the files in graphics/ so a
+ * headless world behaves like the windowed one
+ */
+struct WorldConfig
+{
+    Vec2 mushroomSize = Vec2(27, 26);
+    Vec2 starshipSize = Vec2(21, 27);
+    Vec2 spiderSize = Vec2(48, 29);
+    Vec2 headSize = Vec2(24, 27);
+    Vec2 bodySize = Vec2(22, 24);
+    Vec2 laserSize = Vec2(2, 15);
+
+    int mushroomCount = 30;
+    int centipedeLength = 12; // 1 head and 11 body
+    int centipedeCount = 1; // more for swarm stress runs
+    int startLives = 3;
+    int maxLasers = 256; // shots past this are dropped
+
+    float centipedeSpeed = 100.0f;
+    float starshipSpeed = 300.0f;
+    float laserSpeed = 500.0f;
+    float spiderSpeed = 250.0f;
+    float spiderDirectionChangeInterval = 1.0f;
+    float spiderRespawnInterval = 5.0f;
+};
+
+/**
+ * read-only copy of the world for rendering. moving entities carry their
+ * position from the tick before too, so the renderer can blend between the
+ * two with the fixed timestep alpha
+ */
+struct WorldSnapshot
+{
+    struct SegmentView
+    {
+        Vec2 position;
+        Vec2 previous;
+        bool head;
+    };
+
+    struct LaserView
+    {
+        Vec2 position;
+        Vec2 previous;
+    };
+
+    // one health byte per tile, 0 is empty
+    TileLayout mushroomLayout;
+    std::vector<std::uint8_t> mushroomTiles;
+    std::vector<SegmentView> segments;
+    std::vector<LaserView> lasers;
+    Vec2 starship;
+    Vec2 starshipPrevious;
+    Vec2 spider;
+    Vec2 spiderPrevious;
+    bool spiderActive = false;
+    bool started = false;
+    int score = 0;
+    int lives = 0;
+};
+
+// things that happened during a step, for sound and effects
+enum GameEventType
+{
+    EVENT_MUSHROOM_HIT,
+    EVENT_CENTIPEDE_HIT,
+    EVENT_SPIDER_KILLED,
+    EVENT_PLAYER_DIED,
+    EVENT_GAME_OVER
+};
+
+struct GameEvent
+{
+    GameEventType type;
+    Vec2 position;
+};
+
+// timed parts of step(), in the order they run
+enum WorldPhase
+{
+    PHASE_STARSHIP,
+    PHASE_LASERS,
+    PHASE_LASER_COLLISION,
+    PHASE_SPIDER,
+    PHASE_CENTIPEDES,
+    PHASE_COUNT
+};
+
+// short names for the phases, for display
+extern const char* const WORLD_PHASE_NAMES[PHASE_COUNT];
+
+/**
+ * how collideLasers finds the segments a laser path touches. auto tests
+ * them one by one or with the vector kernel, by the number of lasers in
+ * flight. the others force one path, for checking them against each other.
+ * every path gives the same hits
+ */
+enum CollisionPath
+{
+    COLLISION_AUTO,
+    COLLISION_DIRECT,
+    COLLISION_BATCH,
+    COLLISION_BROADPHASE
+};
+
+/**
+ * reset() seeds the rng and lays out a fresh field, step() advances the
+ * simulation by deltaTime seconds using the given input
+ */
+class GameWorld
+{
+public:
+    explicit GameWorld(const WorldConfig& config = WorldConfig());
+
+    // the same seed and the same inputs always give the same game
+    void reset(std::uint32_t seed);
+    void step(float deltaTime, const InputFrame& input);
+
+    // fills out, reusing its storage
+    void snapshot(WorldSnapshot& out) const;
+
+    // hash of the whole simulation state, for checking replays
+    std::uint64_t checksum() const;
+
+    /**
+     * with phase timing on, step() adds the time of each phase to a total.
+     * takePhaseTimes() copies the totals in seconds and starts them over
+     */
+    void setPhaseTiming(bool enable) { phaseTiming = enable; }
+    void takePhaseTimes(double (&seconds)[PHASE_COUNT]);
+
+    /**
+     * with a scheduler, waves of at least PARALLEL_CENTIPEDES chains update
+     * across its threads. the result is the same with or without one
+     */
+    void setScheduler(TaskScheduler* pool) { scheduler = pool; }
+
+    void setCollisionPath(CollisionPath path) { collisionPath = path; }
+
+    // events of the last step(), the next step clears them
+    const std::vector<GameEvent>& getEvents() const { return events; }
+
+    // live entity counts
+    int getLaserCount() const { return shootLaser.size(); }
+    int getSegmentCount() const;
+
+    const WorldConfig& getConfig() const { return config; }
+    const MushroomField& getMushrooms() const { return mushrooms; }
+    bool isStarted() const { return gameStarted; }
+    int getScore() const { return score; }
+    int getLives() const { return lives; }
+
+private:
+    void restart();
+    void savePrevious();
+    void spawnMushrooms();
+    void spawnCentipede();
+    void fireLaser();
+    void updateStarship(float deltaTime, const InputFrame& input);
+    void updateLasers(float deltaTime);
+    void collideLasers();
+    void updateBroadphase(const AABB& spiderBounds);
+    void findSegmentHit(const AABB& laserPath, int& hitChain, int& hitSegment) const;
+    void packSegments();
+    int chainOf(int segment) const;
+    void shootSegment(int chain, int segment);
+    void removeLaser(int index);
+    void updateSpider(float deltaTime);
+    void emit(GameEventType type, const Vec2& position);
+
+    WorldConfig config;
+    GameRandom gen;
+
+    // below this many chains splitting the work costs more than it saves
+    static const int PARALLEL_CENTIPEDES = 64;
+    static const int CENTIPEDE_GRAIN = 16;
+    TaskScheduler* scheduler = nullptr;
+
+    bool phaseTiming = false;
+    double phaseSeconds[PHASE_COUNT] = {};
+
+    bool gameStarted;
+    int score;
+    int lives;
+
+    MushroomField mushrooms;
+    SegmentPool segments;
+    std::vector<ECE_Centipede> centipedes;
+    LaserPool shootLaser;
+
+    /**
+     * lasers, the spider and every live segment have a box in the
+     * broadphase. it sorts on y: centipedes crawl along rows, so their
+     * order on y rarely changes. laserPairs holds this tick's candidates as
+     * laser proxy, other proxy, sorted by laser
+     */
+    Broadphase broadphase;
+    std::vector<int> segmentProxies; // -1 once the segment is shot
+    int spiderProxy;
+    std::vector<BroadphasePair> pairs;
+    std::vector<BroadphasePair> laserPairs;
+
+    /**
+     * below BATCH_LASERS each laser tests every segment one by one. from
+     * there every live segment is packed into segmentBoxes and each laser
+     * checks all of them with the vector kernel. keeping the broadphase
+     * sorted costs more than that at any laser count the game reaches, so
+     * it only runs when asked for. segmentSlots maps a box back to its
+     * segment
+     */
+    static const int BATCH_LASERS = 4;
+    BoxBatch segmentBoxes;
+    std::vector<int> segmentSlots;
+    std::vector<int> laserTargets;
+    bool broadphaseStale = false;
+    CollisionPath collisionPath = COLLISION_AUTO;
+
+    // reserved once, events past the capacity are dropped
+    static const int MAX_EVENTS = 256;
+    std::vector<GameEvent> events;
+
+    Vec2 starshipPosition;
+    Vec2 starshipPrevious;
+    Vec2 starshipStartPosition;
+
+    Vec2 spiderPosition;
+    Vec2 spiderPrevious;
+    Vec2 spiderStartPosition;
+    Vec2 spiderDirection;
+    float spiderChangeDirectionTime;
+    bool spiderActive;
+    float spiderRespawnTimer;
+};
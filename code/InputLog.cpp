@@ -0,0 +1,217 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Input log reading and writing.
+ */
+#include "InputLog.h"
+
+#include <cmath>
+#include <cstring>
+
+static const char LOG_MAGIC[4] = {'C', 'P', 'I', 'L'};
+// 4: lasers collide along their swept path, older logs play out differently
+// 5: centipede bodies are placed on the head's path
+// 6: the rear part of a split centipede keeps its own direction
+// 7: a turn's step down is part of the centipede path
+static const std::uint16_t LOG_VERSION = 7;
+
+// a log asking for more than this of anything is corrupt, not a big wave
+static const std::uint32_t MAX_LOG_COUNT = 1u << 20;
+
+std::uint8_t packInput(const InputFrame& input)
+{
+    std::uint8_t bits = 0;
+    if (input.left) bits |= INPUT_LEFT;
+    if (input.right) bits |= INPUT_RIGHT;
+    if (input.up) bits |= INPUT_UP;
+    if (input.down) bits |= INPUT_DOWN;
+    if (input.fire) bits |= INPUT_FIRE;
+    if (input.start) bits |= INPUT_START;
+    return bits;
+}
+
+InputFrame unpackInput(std::uint8_t bits)
+{
+    InputFrame input;
+    input.left = (bits & INPUT_LEFT) != 0;
+    input.right = (bits & INPUT_RIGHT) != 0;
+    input.up = (bits & INPUT_UP) != 0;
+    input.down = (bits & INPUT_DOWN) != 0;
+    input.fire = (bits & INPUT_FIRE) != 0;
+    input.start = (bits & INPUT_START) != 0;
+    return input;
+}
+
+// little endian helpers so logs move between machines
+static void writeU32(std::ostream& out, std::uint32_t value)
+{
+    char bytes[4] = {
+        static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF),
+        static_cast<char>((value >> 16) & 0xFF), static_cast<char>((value >> 24) & 0xFF)
+    };
+    out.write(bytes, 4);
+}
+
+static void writeF32(std::ostream& out, float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, 4);
+    writeU32(out, bits);
+}
+
+static bool readU32(std::istream& in, std::uint32_t& value)
+{
+    unsigned char bytes[4];
+    if (!in.read(reinterpret_cast<char*>(bytes), 4)) return false;
+    value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+    return true;
+}
+
+static bool readF32(std::istream& in, float& value)
+{
+    std::uint32_t bits;
+    if (!readU32(in, bits)) return false;
+    std::memcpy(&value, &bits, 4);
+    return true;
+}
+
+// the config fields that change the simulation, in file order
+static void writeConfig(std::ostream& out, const WorldConfig& config)
+{
+    const Vec2* sizes[] = {
+        &config.mushroomSize, &config.starshipSize, &config.spiderSize,
+        &config.headSize, &config.bodySize, &config.laserSize
+    };
+    for (const Vec2* size : sizes)
+    {
+        writeF32(out, size->x);
+        writeF32(out, size->y);
+    }
+    writeU32(out, static_cast<std::uint32_t>(config.mushroomCount));
+    writeU32(out, static_cast<std::uint32_t>(config.centipedeLength));
+    writeU32(out, static_cast<std::uint32_t>(config.centipedeCount));
+    writeU32(out, static_cast<std::uint32_t>(config.startLives));
+    writeU32(out, static_cast<std::uint32_t>(config.maxLasers));
+    writeF32(out, config.centipedeSpeed);
+    writeF32(out, config.starshipSpeed);
+    writeF32(out, config.laserSpeed);
+    writeF32(out, config.spiderSpeed);
+    writeF32(out, config.spiderDirectionChangeInterval);
+    writeF32(out, config.spiderRespawnInterval);
+}
+
+static bool readConfig(std::istream& in, WorldConfig& config)
+{
+    Vec2* sizes[] = {
+        &config.mushroomSize, &config.starshipSize, &config.spiderSize,
+        &config.headSize, &config.bodySize, &config.laserSize
+    };
+    for (Vec2* size : sizes)
+    {
+        if (!readF32(in, size->x) || !readF32(in, size->y)) return false;
+
+        // a zero size would stall the centipede path and the tile grid
+        if (!(size->x > 0.0f) || !(size->y > 0.0f) || !std::isfinite(size->x) || !std::isfinite(size->y))
+        {
+            return false;
+        }
+    }
+    std::uint32_t mushroomCount, centipedeLength, centipedeCount, startLives, maxLasers;
+    if (!readU32(in, mushroomCount) || !readU32(in, centipedeLength) || !readU32(in, centipedeCount)
+        || !readU32(in, startLives) || !readU32(in, maxLasers)) return false;
+    if (centipedeLength == 0 || centipedeCount == 0 || maxLasers == 0) return false;
+    if (mushroomCount > MAX_LOG_COUNT || startLives > MAX_LOG_COUNT || maxLasers > MAX_LOG_COUNT
+        || static_cast<std::uint64_t>(centipedeLength) * centipedeCount > MAX_LOG_COUNT) return false;
+    config.mushroomCount = static_cast<int>(mushroomCount);
+    config.centipedeLength = static_cast<int>(centipedeLength);
+    config.centipedeCount = static_cast<int>(centipedeCount);
+    config.startLives = static_cast<int>(startLives);
+    config.maxLasers = static_cast<int>(maxLasers);
+    return readF32(in, config.centipedeSpeed) && readF32(in, config.starshipSpeed)
+        && readF32(in, config.laserSpeed) && readF32(in, config.spiderSpeed)
+        && readF32(in, config.spiderDirectionChangeInterval) && readF32(in, config.spiderRespawnInterval);
+}
+
+InputRecorder::~InputRecorder()
+{
+    close();
+}
+
+bool InputRecorder::open(const std::string& path, std::uint32_t seed, float tickDelta, const WorldConfig& config)
+{
+    close();
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    file.write(LOG_MAGIC, 4);
+    char version[2] = {static_cast<char>(LOG_VERSION & 0xFF), static_cast<char>(LOG_VERSION >> 8)};
+    file.write(version, 2);
+    writeU32(file, seed);
+    writeF32(file, tickDelta);
+    writeConfig(file, config);
+
+    // patched by close()
+    tickCountOffset = file.tellp();
+    tickCount = 0;
+    writeU32(file, 0);
+    return file.good();
+}
+
+void InputRecorder::record(const InputFrame& input)
+{
+    if (!file.is_open()) return;
+
+    file.put(static_cast<char>(packInput(input)));
+    ++tickCount;
+}
+
+bool InputRecorder::close()
+{
+    if (!file.is_open()) return true;
+
+    file.seekp(tickCountOffset);
+    writeU32(file, tickCount);
+    bool ok = file.good();
+    file.close();
+    return ok;
+}
+
+bool InputReplay::open(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[4];
+    unsigned char version[2];
+    if (!file.read(magic, 4) || std::memcmp(magic, LOG_MAGIC, 4) != 0) return false;
+    if (!file.read(reinterpret_cast<char*>(version), 2) || (version[0] | (version[1] << 8)) != LOG_VERSION) return false;
+
+    std::uint32_t tickCount;
+    if (!readU32(file, seed) || !readF32(file, tickDelta) || !readConfig(file, config) || !readU32(file, tickCount))
+    {
+        return false;
+    }
+
+    // one byte per tick, a count past the end of the file is not allocated
+    std::streampos ticksStart = file.tellg();
+    if (!file.seekg(0, std::ios::end)) return false;
+    std::streamoff remaining = file.tellg() - ticksStart;
+    if (!file.seekg(ticksStart) || remaining < static_cast<std::streamoff>(tickCount)) return false;
+
+    ticks.resize(tickCount);
+    if (tickCount > 0 && !file.read(reinterpret_cast<char*>(ticks.data()), tickCount))
+    {
+        return false;
+    }
+    position = 0;
+    return true;
+}
+
+bool InputReplay::next(InputFrame& input)
+{
+    if (position >= ticks.size()) return false;
+
+    input = unpackInput(ticks[position++]);
+    return true;
+}
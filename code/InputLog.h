@@ -0,0 +1,82 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Binary input recording and replay. A log holds
+ * the seed, the tick length and the world config followed by one byte per
+ * tick with the input bits, so feeding it back through GameWorld::step()
+ * reproduces the session exactly.
+ *
+ * file layout, little endian:
+ *   "CPIL" magic, u16 version, u32 seed, f32 tick delta,
+ *   config fields (see InputLog.cpp), u32 tick count, u8 input bits per tick
+ */
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "GameWorld.h"
+
+// one bit per key
+enum InputBits : std::uint8_t
+{
+    INPUT_LEFT = 1 << 0,
+    INPUT_RIGHT = 1 << 1,
+    INPUT_UP = 1 << 2,
+    INPUT_DOWN = 1 << 3,
+    INPUT_FIRE = 1 << 4,
+    INPUT_START = 1 << 5
+};
+
+std::uint8_t packInput(const InputFrame& input);
+InputFrame unpackInput(std::uint8_t bits);
+
+/**
+ * open() writes the header, record() appends a tick and close() patches in
+ * the tick count
+ */
+class InputRecorder
+{
+public:
+    ~InputRecorder();
+
+    bool open(const std::string& path, std::uint32_t seed, float tickDelta, const WorldConfig& config);
+    void record(const InputFrame& input);
+    bool close();
+
+    bool isOpen() const
+    {
+        return file.is_open();
+    }
+
+private:
+    std::ofstream file;
+    std::streampos tickCountOffset;
+    std::uint32_t tickCount = 0;
+};
+
+/**
+ * open() reads the header and loads every tick, next() hands them out in
+ * order and returns false at the end of the log
+ */
+class InputReplay
+{
+public:
+    bool open(const std::string& path);
+    bool next(InputFrame& input);
+
+    std::uint32_t getSeed() const { return seed; }
+    float getTickDelta() const { return tickDelta; }
+    const WorldConfig& getConfig() const { return config; }
+    std::uint32_t getTickCount() const { return static_cast<std::uint32_t>(ticks.size()); }
+
+private:
+    std::uint32_t seed = 0;
+    float tickDelta = 0.0f;
+    WorldConfig config;
+    std::vector<std::uint8_t> ticks;
+    std::size_t position = 0;
+};
@@ -0,0 +1,97 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Fixed capacity storage for laser blasts. The
+ * array is allocated once, live lasers are always packed at the front and a
+ * removed laser is replaced by the last one, so firing never allocates and
+ * update and collision loops walk one contiguous block.
+ */
+#pragma once
+
+#include <vector>
+
+#include "ECE_LaserBlast.h"
+
+class LaserPool
+{
+public:
+    explicit LaserPool(int capacity = 0)
+    {
+        reserve(capacity);
+    }
+
+    // the only allocation, done when the world is built
+    void reserve(int capacity)
+    {
+        lasers.resize(capacity > 0 ? capacity : 0);
+        if (count > this->capacity()) count = this->capacity();
+    }
+
+    // returns false and drops the shot when the pool is full
+    bool spawn(const Vec2& position, float speed)
+    {
+        if (count == static_cast<int>(lasers.size())) return false;
+        lasers[count++] = ECE_LaserBlast(position, speed);
+        return true;
+    }
+
+    /**
+     * swap and pop, the last laser moves into index. a loop removing while
+     * it walks the pool must look at index again instead of moving on
+     */
+    void remove(int index)
+    {
+        lasers[index] = lasers[--count];
+    }
+
+    void clear()
+    {
+        count = 0;
+    }
+
+    int size() const
+    {
+        return count;
+    }
+
+    int capacity() const
+    {
+        return static_cast<int>(lasers.size());
+    }
+
+    ECE_LaserBlast& operator[](int index)
+    {
+        return lasers[index];
+    }
+
+    const ECE_LaserBlast& operator[](int index) const
+    {
+        return lasers[index];
+    }
+
+    // live lasers only
+    const ECE_LaserBlast* begin() const
+    {
+        return lasers.data();
+    }
+
+    const ECE_LaserBlast* end() const
+    {
+        return lasers.data() + count;
+    }
+
+    ECE_LaserBlast* begin()
+    {
+        return lasers.data();
+    }
+
+    ECE_LaserBlast* end()
+    {
+        return lasers.data() + count;
+    }
+
+private:
+    std::vector<ECE_LaserBlast> lasers;
+    int count = 0;
+};
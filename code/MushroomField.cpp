@@ -0,0 +1,332 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Tile based mushroom field.
+ */
+#include "MushroomField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+MushroomField::MushroomField(const Vec2& origin, const Vec2& tileSize, int columns, int rows)
+    : count(0)
+{
+    layout.origin = origin;
+    layout.tileSize = Vec2(std::max(tileSize.x, 1.0f), std::max(tileSize.y, 1.0f));
+    layout.columns = std::max(columns, 1);
+    layout.rows = std::max(rows, 1);
+    tiles.assign(layout.cellCount(), 0);
+    nextGap.assign(layout.cellCount(), 0);
+    rebuildNavigation();
+}
+
+void MushroomField::clear()
+{
+    std::fill(tiles.begin(), tiles.end(), 0);
+    count = 0;
+    rebuildNavigation();
+}
+
+int MushroomField::chunkEnd(int column) const
+{
+    return std::min((column / NAVIGATION_SPAN + 1) * NAVIGATION_SPAN, layout.columns);
+}
+
+// right to left through each chunk of each row
+void MushroomField::rebuildNavigation()
+{
+    for (int row = 0; row < layout.rows; ++row)
+    {
+        const std::uint8_t* line = &tiles[cellIndex(0, row)];
+        std::uint8_t* gaps = &nextGap[cellIndex(0, row)];
+        int end = layout.columns;
+        while (end > 0)
+        {
+            int start = (end - 1) / NAVIGATION_SPAN * NAVIGATION_SPAN;
+            int next = end;
+            for (int column = end - 1; column >= start; --column)
+            {
+                if (line[column] != 0)
+                {
+                    next = column;
+                }
+                gaps[column] = static_cast<std::uint8_t>(next - column);
+            }
+            end = start;
+        }
+    }
+}
+
+// every tile back to the previous mushroom in the chunk pointed past cell
+void MushroomField::markOccupied(int cell)
+{
+    int column = cell % layout.columns;
+    int rowStart = cell - column;
+    int chunkStart = column - column % NAVIGATION_SPAN;
+    for (int k = column; k >= chunkStart && k + nextGap[rowStart + k] > column; --k)
+    {
+        nextGap[rowStart + k] = static_cast<std::uint8_t>(column - k);
+    }
+}
+
+// the tiles that pointed at cell now point where cell's right neighbour
+// does, or at the next chunk
+void MushroomField::markEmpty(int cell)
+{
+    int column = cell % layout.columns;
+    int rowStart = cell - column;
+    int chunkStart = column - column % NAVIGATION_SPAN;
+    int end = chunkEnd(column);
+    int next = column + 1 < end ? column + 1 + nextGap[cell + 1] : end;
+    for (int k = column; k >= chunkStart && k + nextGap[rowStart + k] == column; --k)
+    {
+        nextGap[rowStart + k] = static_cast<std::uint8_t>(next - k);
+    }
+}
+
+int MushroomField::cellAt(float x, float y) const
+{
+    int column = static_cast<int>(std::floor((x - layout.origin.x) / layout.tileSize.x));
+    int row = static_cast<int>(std::floor((y - layout.origin.y) / layout.tileSize.y));
+    if (column < 0 || column >= layout.columns || row < 0 || row >= layout.rows)
+    {
+        return -1;
+    }
+    return cellIndex(column, row);
+}
+
+bool MushroomField::place(int cell, std::uint8_t health)
+{
+    if (tiles[cell] != 0 || health == 0) return false;
+
+    tiles[cell] = health;
+    ++count;
+    markOccupied(cell);
+    return true;
+}
+
+int MushroomField::scatter(int mushroomCount, int spawnRows, GameRandom& gen)
+{
+    spawnRows = std::max(0, std::min(spawnRows, layout.rows));
+
+    spawnCells.clear();
+    for (int cell = 0; cell < spawnRows * layout.columns; ++cell)
+    {
+        spawnCells.push_back(cell);
+    }
+
+    // partial shuffle picks distinct random tiles. a whole new field gets
+    // its navigation table in one pass instead of one fix up per mushroom
+    std::fill(tiles.begin(), tiles.end(), 0);
+    int placeCount = std::min(mushroomCount, static_cast<int>(spawnCells.size()));
+    for (int i = 0; i < placeCount; ++i)
+    {
+        int pick = gen.nextInt(i, static_cast<int>(spawnCells.size()) - 1);
+        std::swap(spawnCells[i], spawnCells[pick]);
+        tiles[spawnCells[i]] = FULL_HEALTH;
+    }
+    count = placeCount;
+    rebuildNavigation();
+    return placeCount;
+}
+
+int MushroomField::hit(int cell)
+{
+    if (tiles[cell] == 0) return 0;
+
+    if (--tiles[cell] == 0)
+    {
+        --count;
+        markEmpty(cell);
+    }
+    return tiles[cell];
+}
+
+void MushroomField::destroy(int cell)
+{
+    if (tiles[cell] == 0) return;
+
+    tiles[cell] = 0;
+    --count;
+    markEmpty(cell);
+}
+
+// touching edges do not overlap, same as AABB::intersects
+bool MushroomField::tileRange(const AABB& box, int& minColumn, int& minRow, int& maxColumn, int& maxRow) const
+{
+    float left = (box.left - layout.origin.x) / layout.tileSize.x;
+    float top = (box.top - layout.origin.y) / layout.tileSize.y;
+    float right = (box.right() - layout.origin.x) / layout.tileSize.x;
+    float bottom = (box.bottom() - layout.origin.y) / layout.tileSize.y;
+
+    minColumn = std::max(static_cast<int>(std::floor(left)), 0);
+    minRow = std::max(static_cast<int>(std::floor(top)), 0);
+    maxColumn = std::min(static_cast<int>(std::ceil(right)) - 1, layout.columns - 1);
+    maxRow = std::min(static_cast<int>(std::ceil(bottom)) - 1, layout.rows - 1);
+
+    return minColumn <= maxColumn && minRow <= maxRow;
+}
+
+bool MushroomField::overlapsAny(const AABB& box) const
+{
+    int minColumn, minRow, maxColumn, maxRow;
+    if (!tileRange(box, minColumn, minRow, maxColumn, maxRow)) return false;
+
+    for (int row = minRow; row <= maxRow; ++row)
+    {
+        if (firstInRow(row, minColumn, maxColumn) >= 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int MushroomField::firstOverlap(const AABB& box) const
+{
+    int minColumn, minRow, maxColumn, maxRow;
+    if (!tileRange(box, minColumn, minRow, maxColumn, maxRow)) return -1;
+
+    // lasers travel up, so the lowest row is the one reached first
+    for (int row = maxRow; row >= minRow; --row)
+    {
+        int column = firstInRow(row, minColumn, maxColumn);
+        if (column >= 0)
+        {
+            return cellIndex(column, row);
+        }
+    }
+    return -1;
+}
+
+int MushroomField::sweep(const AABB& box, const Vec2& motion, float& hitTime) const
+{
+    int startCell = firstOverlap(box);
+    if (startCell >= 0)
+    {
+        hitTime = 0.0f;
+        return startCell;
+    }
+    if (motion.x == 0.0f && motion.y == 0.0f) return -1;
+
+    // the edge facing the main direction leads, one ray per tile it spans,
+    // each starting inside the box and inside its tile
+    bool vertical = std::fabs(motion.y) >= std::fabs(motion.x);
+    float edge = vertical ? (motion.y < 0.0f ? box.top : box.bottom())
+                          : (motion.x < 0.0f ? box.left : box.right());
+    float spanStart = vertical ? box.left : box.top;
+    float spanEnd = vertical ? box.right() : box.bottom();
+    float origin = vertical ? layout.origin.x : layout.origin.y;
+    float tile = vertical ? layout.tileSize.x : layout.tileSize.y;
+
+    int first = static_cast<int>(std::floor((spanStart - origin) / tile));
+    int last = static_cast<int>(std::ceil((spanEnd - origin) / tile)) - 1;
+    int lines = vertical ? layout.columns : layout.rows;
+    first = std::max(first, 0);
+    last = std::min(last, lines - 1);
+
+    int hitCell = -1;
+    hitTime = 1.0f;
+    for (int line = first; line <= last; ++line)
+    {
+        float centre = origin + (line + 0.5f) * tile;
+        float across = std::min(std::max(centre, spanStart), spanEnd);
+        Vec2 rayOrigin = vertical ? Vec2(across, edge) : Vec2(edge, across);
+
+        float rayTime = hitTime;
+        int cell = castRay(rayOrigin, motion, rayTime);
+        if (cell >= 0 && (hitCell < 0 || rayTime < hitTime))
+        {
+            hitCell = cell;
+            hitTime = rayTime;
+        }
+    }
+    return hitCell;
+}
+
+// Amanatides and Woo grid walk: step into whichever neighbour tile the ray
+// reaches first until a mushroom is found or the motion is used up
+int MushroomField::castRay(const Vec2& origin, const Vec2& motion, float& hitTime) const
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    // in tile units
+    float x = (origin.x - layout.origin.x) / layout.tileSize.x;
+    float y = (origin.y - layout.origin.y) / layout.tileSize.y;
+    float dx = motion.x / layout.tileSize.x;
+    float dy = motion.y / layout.tileSize.y;
+
+    int column = static_cast<int>(std::floor(x));
+    int row = static_cast<int>(std::floor(y));
+    int stepColumn = dx > 0.0f ? 1 : -1;
+    int stepRow = dy > 0.0f ? 1 : -1;
+    float deltaX = dx != 0.0f ? 1.0f / std::fabs(dx) : infinity;
+    float deltaY = dy != 0.0f ? 1.0f / std::fabs(dy) : infinity;
+    float nextX = dx > 0.0f ? (column + 1 - x) * deltaX : (dx < 0.0f ? (x - column) * deltaX : infinity);
+    float nextY = dy > 0.0f ? (row + 1 - y) * deltaY : (dy < 0.0f ? (y - row) * deltaY : infinity);
+
+    float time = 0.0f;
+    while (time <= hitTime)
+    {
+        if (column >= 0 && column < layout.columns && row >= 0 && row < layout.rows)
+        {
+            int cell = cellIndex(column, row);
+            if (tiles[cell] != 0)
+            {
+                hitTime = time;
+                return cell;
+            }
+        } else if ((column < 0 && stepColumn < 0) || (column >= layout.columns && stepColumn > 0)
+                   || (row < 0 && stepRow < 0) || (row >= layout.rows && stepRow > 0))
+        {
+            return -1; // left the field for good
+        }
+
+        if (nextX < nextY)
+        {
+            time = nextX;
+            nextX += deltaX;
+            column += stepColumn;
+        } else
+        {
+            time = nextY;
+            nextY += deltaY;
+            row += stepRow;
+        }
+    }
+    return -1;
+}
+
+void MushroomField::diff(const std::vector<std::uint8_t>& before, const std::vector<std::uint8_t>& after,
+                         std::vector<int>& changed)
+{
+    size_t size = std::min(before.size(), after.size());
+
+    // most tiles never change, skip eight at a time
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        std::uint64_t a, b;
+        std::memcpy(&a, &before[i], 8);
+        std::memcpy(&b, &after[i], 8);
+        if (a == b) continue;
+
+        for (size_t j = i; j < i + 8; ++j)
+        {
+            if (before[j] != after[j])
+            {
+                changed.push_back(static_cast<int>(j));
+            }
+        }
+    }
+    for (; i < size; ++i)
+    {
+        if (before[i] != after[i])
+        {
+            changed.push_back(static_cast<int>(i));
+        }
+    }
+}
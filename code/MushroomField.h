@@ -0,0 +1,190 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Mushrooms live on a tile grid like the arcade
+ * game. The field keeps one byte per tile holding the mushroom health
+ * (0 means empty), so occupancy, damage and removal are O(1) array
+ * accesses and a box query only touches the tiles under the box.
+ *
+ * Next to the health bytes the field keeps a navigation table: for every
+ * tile how many tiles it is to the first mushroom at or to the right of it
+ * in the same row, looking no further than the end of its NAVIGATION_SPAN
+ * wide chunk of the row. That fits a byte, so the table is no bigger than
+ * the health bytes. Whether a head, or any box, runs into a mushroom is
+ * then a read or two per row it covers. Placing or removing a mushroom
+ * only fixes the tiles between it and the mushroom before it in the
+ * chunk, so a change costs at most one chunk however wide the field is.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GameRandom.h"
+#include "GameTypes.h"
+
+/**
+ * tile geometry, shared with the renderer
+ */
+struct TileLayout
+{
+    Vec2 origin;
+    Vec2 tileSize;
+    int columns = 0;
+    int rows = 0;
+
+    int cellCount() const
+    {
+        return columns * rows;
+    }
+
+    AABB cellBounds(int cell) const
+    {
+        return AABB(origin.x + (cell % columns) * tileSize.x,
+                    origin.y + (cell / columns) * tileSize.y,
+                    tileSize.x, tileSize.y);
+    }
+};
+
+/**
+ * place() puts a full health mushroom on an empty tile, hit() takes one
+ * point of health off and destroy() empties the tile
+ */
+class MushroomField
+{
+public:
+    static const std::uint8_t FULL_HEALTH = 2; // mushroom0 and mushroom1
+
+    MushroomField(const Vec2& origin, const Vec2& tileSize, int columns, int rows);
+
+    void clear();
+
+    const TileLayout& getLayout() const
+    {
+        return layout;
+    }
+
+    // one health byte per tile, row major
+    const std::vector<std::uint8_t>& getTiles() const
+    {
+        return tiles;
+    }
+
+    // number of mushrooms on the field
+    int size() const
+    {
+        return count;
+    }
+
+    int cellIndex(int column, int row) const
+    {
+        return row * layout.columns + column;
+    }
+
+    // tile under the point, -1 outside the field
+    int cellAt(float x, float y) const;
+
+    // column of the first mushroom in row from minColumn to maxColumn, -1 if none
+    int firstInRow(int row, int minColumn, int maxColumn) const
+    {
+        // an occupied tile has gap 0, an empty one leads to the next
+        // mushroom or the start of the next chunk
+        int column = minColumn;
+        while (column <= maxColumn)
+        {
+            int gap = nextGap[cellIndex(column, row)];
+            if (gap == 0)
+            {
+                return column;
+            }
+            column += gap;
+        }
+        return -1;
+    }
+
+    bool isOccupied(int cell) const
+    {
+        return tiles[cell] != 0;
+    }
+
+    // false if the tile already holds a mushroom
+    bool place(int cell, std::uint8_t health = FULL_HEALTH);
+
+    // returns the health left, 0 when the mushroom is gone
+    int hit(int cell);
+
+    /**
+     * clears the field and places mushroomCount mushrooms on distinct random tiles
+     * of the top spawnRows rows. returns how many fit
+     */
+    int scatter(int mushroomCount, int spawnRows, GameRandom& gen);
+
+    void destroy(int cell);
+
+    bool overlapsAny(const AABB& box) const;
+
+    // occupied tile overlapping box closest to the bottom of the field, -1 if none
+    int firstOverlap(const AABB& box) const;
+
+    /**
+     * first occupied tile the box runs into while it moves by motion, -1 if
+     * none. hitTime is the fraction of motion done at first contact, 0 when
+     * the box starts on a mushroom. Rays from the leading edge of the box,
+     * one per tile it spans, walk the grid tile by tile (DDA), so the cost
+     * is the number of tiles crossed however far the box moves. Exact for
+     * motion along an axis, which is how lasers move
+     */
+    int sweep(const AABB& box, const Vec2& motion, float& hitTime) const;
+
+    // calls fn(cell) for every occupied tile overlapping box
+    template <typename Fn>
+    void forEachOverlap(const AABB& box, Fn fn) const
+    {
+        int minColumn, minRow, maxColumn, maxRow;
+        if (!tileRange(box, minColumn, minRow, maxColumn, maxRow)) return;
+
+        // jumps from mushroom to mushroom, fn may remove the one it gets
+        for (int row = minRow; row <= maxRow; ++row)
+        {
+            int column = firstInRow(row, minColumn, maxColumn);
+            while (column >= 0)
+            {
+                fn(cellIndex(column, row));
+                column = firstInRow(row, column + 1, maxColumn);
+            }
+        }
+    }
+
+    // appends the tiles that differ between two copies of getTiles()
+    static void diff(const std::vector<std::uint8_t>& before, const std::vector<std::uint8_t>& after,
+                     std::vector<int>& changed);
+
+private:
+    // tiles a box overlaps, false if it misses the field
+    bool tileRange(const AABB& box, int& minColumn, int& minRow, int& maxColumn, int& maxRow) const;
+
+    // first occupied tile entered by a point moving by motion, within hitTime of the motion
+    int castRay(const Vec2& origin, const Vec2& motion, float& hitTime) const;
+
+    // columns per chunk of a row in the navigation table
+    static const int NAVIGATION_SPAN = 32;
+
+    // last column + 1 of the chunk holding column
+    int chunkEnd(int column) const;
+
+    // nextGap from scratch, for a new or cleared field
+    void rebuildNavigation();
+
+    // keep nextGap in step with a tile that just got or lost its mushroom
+    void markOccupied(int cell);
+    void markEmpty(int cell);
+
+    TileLayout layout;
+    std::vector<std::uint8_t> tiles;
+    std::vector<std::uint8_t> nextGap;
+    int count;
+
+    // scratch for scatter(), kept to avoid allocating on every new field
+    std::vector<int> spawnCells;
+};
@@ -0,0 +1,171 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Performance overlay graph and stats panel.
+ */
+#include "PerfHud.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+using namespace sf;
+
+// one bar per frame, full height is two 60 fps frames
+static const int GRAPH_SAMPLES = 200;
+static const float GRAPH_LEFT = 8.0f;
+static const float GRAPH_TOP = 4.0f;
+static const float GRAPH_HEIGHT = TOP_AREA_HEIGHT - 8.0f;
+static const float GRAPH_MAX_TIME = 2.0f / 60.0f;
+
+// text is rebuilt this often, in seconds
+static const float TEXT_REFRESH = 0.25f;
+
+static const char* const FRAME_PHASE_NAMES[FRAME_PHASE_COUNT] = {"events", "update", "render", "display"};
+
+static void setQuad(Vertex* quad, float left, float top, float width, float height, const Color& color)
+{
+    quad[0].position = Vector2f(left, top);
+    quad[1].position = Vector2f(left + width, top);
+    quad[2].position = Vector2f(left + width, top + height);
+    quad[3].position = Vector2f(left, top + height);
+    for (int i = 0; i < 4; ++i)
+    {
+        quad[i].color = color;
+    }
+}
+
+PerfHud::PerfHud(const Font& font)
+    : visible(false), graph(Quads, (GRAPH_SAMPLES + 2) * 4), graphSlot(0),
+      phaseStats(FRAME_PHASE_COUNT + PHASE_COUNT), rateTicks(0), rateFrames(0), simRate(0.0f), frameRate(0.0f),
+      textAge(0.0f)
+{
+    for (int slot = 0; slot < GRAPH_SAMPLES; ++slot)
+    {
+        setBar(slot, 0.0f);
+    }
+
+    // marker lines at 16.7 and 8.3 ms
+    const float markers[] = {1.0f / 60.0f, 1.0f / 120.0f};
+    for (int i = 0; i < 2; ++i)
+    {
+        float y = GRAPH_TOP + GRAPH_HEIGHT * (1.0f - markers[i] / GRAPH_MAX_TIME);
+        setQuad(&graph[(GRAPH_SAMPLES + i) * 4], GRAPH_LEFT, y, GRAPH_SAMPLES, 1.0f, Color(255, 255, 255, 90));
+    }
+
+    panel.setPosition(0.0f, TOP_AREA_HEIGHT);
+    panel.setFillColor(Color(0, 0, 0, 190));
+
+    // name, p50, p99 and max columns, the font is not monospaced
+    const float columnX[4] = {8.0f, 100.0f, 160.0f, 220.0f};
+    for (int i = 0; i < 4; ++i)
+    {
+        columns[i].setFont(font);
+        columns[i].setCharacterSize(12);
+        columns[i].setFillColor(Color::White);
+        columns[i].setPosition(columnX[i], TOP_AREA_HEIGHT + 4.0f);
+    }
+}
+
+// bar color says which frame rate the frame still made
+void PerfHud::setBar(int slot, float frameTime)
+{
+    float height = std::min(frameTime / GRAPH_MAX_TIME, 1.0f) * GRAPH_HEIGHT;
+    Color color = frameTime <= 1.0f / 120.0f ? Color::Green
+                : frameTime <= 1.0f / 60.0f ? Color::Yellow : Color::Red;
+    setQuad(&graph[slot * 4], GRAPH_LEFT + slot, GRAPH_TOP + GRAPH_HEIGHT - height, 1.0f, height, color);
+}
+
+void PerfHud::addFrame(float frameTime, const double (&framePhases)[FRAME_PHASE_COUNT],
+                       const double (*worldPhases)[PHASE_COUNT], const HudCounts& frameCounts)
+{
+    frameStats.add(frameTime);
+    for (int phase = 0; phase < FRAME_PHASE_COUNT; ++phase)
+    {
+        phaseStats[phase].add(static_cast<float>(framePhases[phase]));
+    }
+    for (int phase = 0; worldPhases && phase < PHASE_COUNT; ++phase)
+    {
+        phaseStats[FRAME_PHASE_COUNT + phase].add(static_cast<float>((*worldPhases)[phase]));
+    }
+    counts = frameCounts;
+    ++rateFrames;
+
+    // sweeps left to right, the empty bar after the newest one marks "now"
+    setBar(graphSlot, frameTime);
+    graphSlot = (graphSlot + 1) % GRAPH_SAMPLES;
+    setBar(graphSlot, 0.0f);
+
+    textAge += frameTime;
+    if (textAge >= TEXT_REFRESH)
+    {
+        // first refresh after showing the hud has no tick count to compare to
+        simRate = rateTicks > 0 ? (counts.simTicks - rateTicks) / textAge : 0.0f;
+        frameRate = rateFrames / textAge;
+        rateTicks = counts.simTicks;
+        rateFrames = 0;
+        textAge = 0.0f;
+        rebuildText();
+    }
+}
+
+void PerfHud::rebuildText()
+{
+    std::string text[4] = {"ms", "p50", "p99", "max"};
+    char number[32];
+
+    auto addRow = [&](const char* name, const RollingStats& stats)
+    {
+        text[0] += std::string("\n") + name;
+        const float values[3] = {stats.percentile(0.5f), stats.percentile(0.99f), stats.maximum()};
+        for (int i = 0; i < 3; ++i)
+        {
+            std::snprintf(number, sizeof(number), "\n%.3f", values[i] * 1000.0f);
+            text[i + 1] += number;
+        }
+    };
+
+    addRow("frame", frameStats);
+    for (int phase = 0; phase < FRAME_PHASE_COUNT; ++phase)
+    {
+        addRow(FRAME_PHASE_NAMES[phase], phaseStats[phase]);
+    }
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        std::string name = std::string("  ") + WORLD_PHASE_NAMES[phase];
+        addRow(name.c_str(), phaseStats[FRAME_PHASE_COUNT + phase]);
+    }
+
+    // counts go under the table, name and value columns
+    const char* countNames[6] = {"sim ticks/s", "frames/s", "mushrooms", "lasers", "segments", "draw calls"};
+    const int countValues[6] = {static_cast<int>(simRate + 0.5f), static_cast<int>(frameRate + 0.5f),
+                                counts.mushrooms, counts.lasers, counts.segments, counts.drawCalls};
+    text[0] += "\n";
+    text[1] += "\n";
+    for (int i = 0; i < 6; ++i)
+    {
+        text[0] += std::string("\n") + countNames[i];
+        std::snprintf(number, sizeof(number), "\n%d", countValues[i]);
+        text[1] += number;
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        columns[i].setString(text[i]);
+    }
+    FloatRect bounds = columns[0].getGlobalBounds();
+    panel.setSize(Vector2f(290.0f, bounds.top + bounds.height + 6.0f - TOP_AREA_HEIGHT));
+}
+
+void PerfHud::draw(RenderTarget& target)
+{
+    if (!visible) return;
+
+    target.draw(graph);
+    target.draw(panel);
+    for (const Text& column : columns)
+    {
+        target.draw(column);
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Performance overlay for the top information
+ * area, toggled in game with F3. A rolling frame time graph sits left of
+ * the score and a panel under it lists p50/p99/max of every frame and
+ * simulation phase over the last few seconds, the sim tick and render
+ * frame rates, and live entity and draw call counts. The graph is one
+ * vertex array and only the newest bar is rewritten each frame, the text
+ * is rebuilt a few times a second.
+ */
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "GameWorld.h"
+#include "PerfStats.h"
+
+// parts of a frame the front end times itself
+enum FramePhase
+{
+    FRAME_EVENTS,
+    FRAME_UPDATE,
+    FRAME_RENDER,
+    FRAME_DISPLAY,
+    FRAME_PHASE_COUNT
+};
+
+struct HudCounts
+{
+    int mushrooms = 0;
+    int lasers = 0;
+    int segments = 0;
+    int drawCalls = 0;
+    std::uint64_t simTicks = 0; // total so far, the hud turns it into a rate
+};
+
+class PerfHud
+{
+public:
+    explicit PerfHud(const sf::Font& font);
+
+    // rates start over, hidden frames are not counted
+    void toggle()
+    {
+        visible = !visible;
+        rateTicks = 0;
+        rateFrames = 0;
+        textAge = 0.0f;
+    }
+
+    bool isVisible() const
+    {
+        return visible;
+    }
+
+    /**
+     * once per frame while visible, times are in seconds. worldPhases is
+     * null when the sim thread has not published a new tick since the last
+     * frame
+     */
+    void addFrame(float frameTime, const double (&framePhases)[FRAME_PHASE_COUNT],
+                  const double (*worldPhases)[PHASE_COUNT], const HudCounts& counts);
+
+    void draw(sf::RenderTarget& target);
+
+private:
+    void setBar(int slot, float frameTime);
+    void rebuildText();
+
+    bool visible;
+
+    // graph bars, then the 60 and 120 fps marker lines
+    sf::VertexArray graph;
+    int graphSlot;
+
+    RollingStats frameStats;
+    std::vector<RollingStats> phaseStats; // frame phases then world phases
+    HudCounts counts;
+
+    // sim tick and render frame rates, measured between text rebuilds
+    std::uint64_t rateTicks;
+    int rateFrames;
+    float simRate;
+    float frameRate;
+
+    sf::RectangleShape panel;
+    sf::Text columns[4];
+    float textAge;
+};
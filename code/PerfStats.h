@@ -0,0 +1,100 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Small timing helpers for the performance HUD.
+ * PhaseTimer adds the time of its scope to a running total, RollingStats
+ * keeps the last few hundred samples of one value and gives percentiles.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+/**
+ * adds the seconds between construction and destruction to total, does
+ * nothing (not even read the clock) when enabled is false
+ */
+class PhaseTimer
+{
+public:
+    PhaseTimer(bool enabled, double& total)
+        : total(enabled ? &total : nullptr)
+    {
+        if (this->total)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~PhaseTimer()
+    {
+        if (total)
+        {
+            *total += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    double* total;
+    std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * ring of the last capacity samples. percentile() sorts a copy, so call it
+ * a few times a second rather than every frame
+ */
+class RollingStats
+{
+public:
+    explicit RollingStats(int capacity = 240)
+        : samples(std::max(capacity, 1), 0.0f), next(0), count(0)
+    {
+    }
+
+    void add(float value)
+    {
+        samples[next] = value;
+        next = (next + 1) % static_cast<int>(samples.size());
+        count = std::min(count + 1, static_cast<int>(samples.size()));
+    }
+
+    // p between 0 and 1, 0 when there are no samples
+    float percentile(float p) const
+    {
+        if (count == 0) return 0.0f;
+
+        sorted.assign(samples.begin(), samples.begin() + count);
+        int rank = std::min(static_cast<int>(p * count), count - 1);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        return sorted[rank];
+    }
+
+    float maximum() const
+    {
+        if (count == 0) return 0.0f;
+        return *std::max_element(samples.begin(), samples.begin() + count);
+    }
+
+    // most recent sample
+    float last() const
+    {
+        if (count == 0) return 0.0f;
+        return samples[(next + samples.size() - 1) % samples.size()];
+    }
+
+    int size() const
+    {
+        return count;
+    }
+
+private:
+    std::vector<float> samples;
+    mutable std::vector<float> sorted;
+    int next;
+    int count;
+};
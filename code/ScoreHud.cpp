@@ -0,0 +1,170 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Baked digit atlas and the cached info area.
+ */
+#include "ScoreHud.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "GameTypes.h"
+
+using namespace sf;
+
+// space between life icons and to the right edge
+static const float ICON_GAP = 5.0f;
+static const float ICON_MARGIN = 10.0f;
+static const float ICON_SCALE = 0.5f;
+
+static void addQuad(VertexArray& quads, const FloatRect& dest, const IntRect& source)
+{
+    float sourceRight = static_cast<float>(source.left + source.width);
+    float sourceBottom = static_cast<float>(source.top + source.height);
+    quads.append(Vertex(Vector2f(dest.left, dest.top), Vector2f(source.left, source.top)));
+    quads.append(Vertex(Vector2f(dest.left + dest.width, dest.top), Vector2f(sourceRight, source.top)));
+    quads.append(Vertex(Vector2f(dest.left + dest.width, dest.top + dest.height), Vector2f(sourceRight, sourceBottom)));
+    quads.append(Vertex(Vector2f(dest.left, dest.top + dest.height), Vector2f(source.left, sourceBottom)));
+}
+
+ScoreHud::ScoreHud()
+    : metrics(), iconTexture(nullptr), quads(Quads), score(-1), lives(-1)
+{
+}
+
+bool ScoreHud::bakeDigits(const Font& font, unsigned int characterSize, Image& digits, DigitMetrics& out)
+{
+    // every digit gets a cell as wide as the widest one and a full line high
+    float cellWidth = 0.0f;
+    float inkBottom = 0.0f;
+    out.inkTop = static_cast<float>(characterSize);
+    for (int digit = 0; digit < 10; ++digit)
+    {
+        const Glyph& glyph = font.getGlyph('0' + digit, characterSize, false);
+        out.advance[digit] = glyph.advance;
+        cellWidth = std::max(cellWidth, std::max(glyph.advance, glyph.bounds.left + glyph.bounds.width));
+
+        // text puts the baseline characterSize below its position
+        out.inkTop = std::min(out.inkTop, characterSize + glyph.bounds.top);
+        inkBottom = std::max(inkBottom, characterSize + glyph.bounds.top + glyph.bounds.height);
+    }
+    out.inkHeight = inkBottom - out.inkTop;
+
+    unsigned int cell = static_cast<unsigned int>(std::ceil(cellWidth));
+    unsigned int lineHeight = static_cast<unsigned int>(std::ceil(std::max(inkBottom, font.getLineSpacing(characterSize))));
+    RenderTexture target;
+    if (!target.create(cell * 10, lineHeight))
+    {
+        return false;
+    }
+
+    target.clear(Color::Transparent);
+    Text text;
+    text.setFont(font);
+    text.setCharacterSize(characterSize);
+    text.setFillColor(Color::White);
+    for (int digit = 0; digit < 10; ++digit)
+    {
+        text.setString(std::string(1, static_cast<char>('0' + digit)));
+        text.setPosition(static_cast<float>(digit * cell), 0.0f);
+        target.draw(text);
+    }
+    target.display();
+    digits = target.getTexture().copyToImage();
+    return true;
+}
+
+bool ScoreHud::create(const Font& font, unsigned int characterSize, const Texture& icons, const IntRect& icon)
+{
+    Image digits;
+    DigitMetrics baked;
+    if (!bakeDigits(font, characterSize, digits, baked))
+    {
+        return false;
+    }
+    return create(digits.getPixelsPtr(), digits.getSize().x, digits.getSize().y, baked, icons, icon);
+}
+
+bool ScoreHud::create(const Uint8* digitPixels, unsigned int width, unsigned int height, const DigitMetrics& baked,
+                      const Texture& icons, const IntRect& icon)
+{
+    iconTexture = &icons;
+    iconRect = icon;
+    metrics = baked;
+
+    if (!digitAtlas.create(width, height) || !cache.create(WIDTH, TOP_AREA_HEIGHT))
+    {
+        return false;
+    }
+    digitAtlas.update(digitPixels);
+
+    int cell = static_cast<int>(width / 10);
+    for (int digit = 0; digit < 10; ++digit)
+    {
+        digitRects[digit] = IntRect(digit * cell, 0, cell, static_cast<int>(height));
+    }
+
+    score = -1;
+    lives = -1;
+    return true;
+}
+
+void ScoreHud::update(int newScore, int newLives)
+{
+    if (newScore == score && newLives == lives) return;
+
+    score = newScore;
+    lives = newLives;
+    redraw();
+}
+
+void ScoreHud::redraw()
+{
+    cache.clear(Color::Black); // info area background
+
+    // score at the middle of info area
+    std::string digits = std::to_string(std::max(score, 0));
+    float width = 0.0f;
+    for (char c : digits)
+    {
+        width += metrics.advance[c - '0'];
+    }
+    float x = std::floor((WIDTH - width) / 2.0f);
+    float y = std::floor((TOP_AREA_HEIGHT - metrics.inkHeight) / 2.0f - metrics.inkTop);
+
+    quads.clear();
+    for (char c : digits)
+    {
+        const IntRect& rect = digitRects[c - '0'];
+        addQuad(quads, FloatRect(x, y, rect.width, rect.height), rect);
+        x += metrics.advance[c - '0'];
+    }
+    cache.draw(quads, &digitAtlas);
+
+    // life icons on the right side of info area
+    if (iconTexture && lives > 0)
+    {
+        float iconWidth = iconRect.width * ICON_SCALE;
+        float iconHeight = iconRect.height * ICON_SCALE;
+        float lifeIconWidth = lives * (iconWidth + ICON_GAP) - ICON_GAP;
+        float livesStartX = WIDTH - lifeIconWidth - ICON_MARGIN;
+        float lifeIconY = (TOP_AREA_HEIGHT - iconHeight) / 2.0f;
+
+        quads.clear();
+        for (int i = 0; i < lives; ++i)
+        {
+            addQuad(quads, FloatRect(livesStartX + i * (iconWidth + ICON_GAP), lifeIconY, iconWidth, iconHeight), iconRect);
+        }
+        cache.draw(quads, iconTexture);
+    }
+
+    cache.display();
+}
+
+void ScoreHud::draw(RenderTarget& target) const
+{
+    Sprite sprite(cache.getTexture());
+    target.draw(sprite);
+}
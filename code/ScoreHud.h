@@ -0,0 +1,59 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Score and life icons of the top information
+ * area. The digits are baked from the font into a small bitmap atlas once
+ * at startup, and the whole info area is rendered into a cached texture
+ * that is only redrawn when the score or the lives change. Every other
+ * frame the info area is a single textured quad. The asset pack stores the
+ * baked digits, so a packed start skips the font rendering.
+ */
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "AssetPack.h"
+
+class ScoreHud
+{
+public:
+    ScoreHud();
+
+    /**
+     * bakes the digits of font at characterSize and remembers the life
+     * icon, which is drawn at half size. false if a render texture could
+     * not be created
+     */
+    bool create(const sf::Font& font, unsigned int characterSize, const sf::Texture& iconTexture,
+                const sf::IntRect& iconRect);
+
+    // digits baked ahead of time, rgba8 pixels of ten cells side by side
+    bool create(const sf::Uint8* digitPixels, unsigned int width, unsigned int height, const DigitMetrics& metrics,
+                const sf::Texture& iconTexture, const sf::IntRect& iconRect);
+
+    // renders the digits of font into digits, needs an OpenGL context
+    static bool bakeDigits(const sf::Font& font, unsigned int characterSize, sf::Image& digits, DigitMetrics& metrics);
+
+    // redraws the cached info area if the values differ from the last call
+    void update(int score, int lives);
+
+    // one quad covering the info area
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    void redraw();
+
+    // digits 0 to 9 side by side, one cell each
+    sf::Texture digitAtlas;
+    sf::IntRect digitRects[10];
+    DigitMetrics metrics;
+
+    const sf::Texture* iconTexture;
+    sf::IntRect iconRect;
+
+    sf::RenderTexture cache;
+    sf::VertexArray quads; // scratch for redraw()
+    int score;
+    int lives;
+};
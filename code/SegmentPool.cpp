@@ -0,0 +1,42 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Segment pool storage.
+ */
+#include "SegmentPool.h"
+
+void SegmentPool::clear()
+{
+    x.clear();
+    y.clear();
+    previousX.clear();
+    previousY.clear();
+    pathX.clear();
+    pathY.clear();
+}
+
+int SegmentPool::allocate(int count)
+{
+    int first = size();
+    x.resize(first + count, 0.0f);
+    y.resize(first + count, 0.0f);
+    previousX.resize(first + count, 0.0f);
+    previousY.resize(first + count, 0.0f);
+    pathX.resize(pathBase(first + count), 0.0f);
+    pathY.resize(pathBase(first + count), 0.0f);
+
+    // big enough for any split to park the path points it keeps
+    if (scratchX.size() < pathX.size())
+    {
+        scratchX.resize(pathX.size());
+        scratchY.resize(pathY.size());
+    }
+    return first;
+}
+
+void SegmentPool::savePrevious()
+{
+    previousX = x;
+    previousY = y;
+}
@@ -0,0 +1,98 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Centipede segment positions for every centipede,
+ * stored as separate contiguous x and y arrays. A centipede owns a range of
+ * the pool, its first segment is the head. Next to the positions the pool
+ * keeps the path each head walked: PATH_SAMPLES points per segment of
+ * spacing, and a centipede's rings of path points live in the part of the
+ * path arrays that belongs to its range. Body segments are read off that
+ * path at a fixed distance behind the head, see ECE_Centipede.
+ */
+#pragma once
+
+#include <vector>
+
+#include "CpuFeatures.h"
+#include "GameTypes.h"
+
+class SegmentPool
+{
+public:
+    // path points per body spacing, a segment is this many points behind the one in front
+    static const int PATH_SAMPLES = 4;
+
+    void clear();
+
+    // appends count segments and their path room, returns the index of the first one
+    int allocate(int count);
+
+    int size() const
+    {
+        return static_cast<int>(x.size());
+    }
+
+    // remembered for render interpolation
+    void savePrevious();
+
+    /**
+     * segments first to first + n - 1 are put between path points from + k
+     * and to + k, t of the way to the second. the points and segments are
+     * contiguous runs, so this is a vector lerp over both axes. a body is a
+     * dozen segments, so 4 lanes inlined here beat wider lanes behind a
+     * call. the vector path does the same operations as the scalar one and
+     * gives the same bits
+     */
+    void placeFromPath(int first, int from, int to, int n, float t)
+    {
+        float* outX = x.data() + first;
+        float* outY = y.data() + first;
+        const float* fromX = pathX.data() + from;
+        const float* fromY = pathY.data() + from;
+        int offset = to - from;
+#if defined(CPU_X86)
+        if (n >= 4)
+        {
+            // a short tail is one more block ending at n, a few lanes are
+            // written twice with the same values
+            const __m128 tVector = _mm_set1_ps(t);
+            for (int k = 0; k < n; k += 4)
+            {
+                int i = k + 4 <= n ? k : n - 4;
+                __m128 ax = _mm_loadu_ps(fromX + i);
+                __m128 ay = _mm_loadu_ps(fromY + i);
+                __m128 dx = _mm_sub_ps(_mm_loadu_ps(fromX + offset + i), ax);
+                __m128 dy = _mm_sub_ps(_mm_loadu_ps(fromY + offset + i), ay);
+                _mm_storeu_ps(outX + i, _mm_add_ps(ax, _mm_mul_ps(dx, tVector)));
+                _mm_storeu_ps(outY + i, _mm_add_ps(ay, _mm_mul_ps(dy, tVector)));
+            }
+            return;
+        }
+#endif
+        for (int k = 0; k < n; ++k)
+        {
+            outX[k] = fromX[k] + (fromX[offset + k] - fromX[k]) * t;
+            outY[k] = fromY[k] + (fromY[offset + k] - fromY[k]) * t;
+        }
+    }
+
+    // path room of the segment range starting at first, 2 * PATH_SAMPLES floats per segment
+    static int pathBase(int first)
+    {
+        return first * 2 * PATH_SAMPLES;
+    }
+
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> previousX;
+    std::vector<float> previousY;
+
+    // path points of every centipede, laid out by ECE_Centipede
+    std::vector<float> pathX;
+    std::vector<float> pathY;
+
+    // room for copying path points around when a centipede splits
+    std::vector<float> scratchX;
+    std::vector<float> scratchY;
+};
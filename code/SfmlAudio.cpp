@@ -0,0 +1,37 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: sf::Sound voices for the audio mixer.
+ */
+#include "SfmlAudio.h"
+
+SfmlAudioBackend::SfmlAudioBackend(const sf::SoundBuffer* const (&buffers)[SOUND_COUNT], int voiceCount)
+    : sounds(voiceCount * SOUND_COUNT), playing(voiceCount, -1)
+{
+    for (int voice = 0; voice < voiceCount; ++voice)
+    {
+        for (int sound = 0; sound < SOUND_COUNT; ++sound)
+        {
+            sounds[voice * SOUND_COUNT + sound].setBuffer(*buffers[sound]);
+        }
+    }
+}
+
+void SfmlAudioBackend::play(int voice, SoundId sound, float volume)
+{
+    stop(voice);
+    sf::Sound& next = sounds[voice * SOUND_COUNT + sound];
+    next.setVolume(volume * 100.0f);
+    next.play();
+    playing[voice] = sound;
+}
+
+void SfmlAudioBackend::stop(int voice)
+{
+    if (playing[voice] >= 0)
+    {
+        sounds[voice * SOUND_COUNT + playing[voice]].stop();
+        playing[voice] = -1;
+    }
+}
@@ -0,0 +1,29 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: AudioMixer backend on top of sf::Sound. Binding
+ * a buffer to an sf::Sound registers the sound with the buffer, which
+ * allocates, so every voice gets one sf::Sound per sound bound up front and
+ * playing a voice only starts the right one.
+ */
+#pragma once
+
+#include <SFML/Audio.hpp>
+#include <vector>
+
+#include "AudioMixer.h"
+
+class SfmlAudioBackend : public AudioBackend
+{
+public:
+    // the buffers, indexed by SoundId, must outlive the backend
+    SfmlAudioBackend(const sf::SoundBuffer* const (&buffers)[SOUND_COUNT], int voiceCount);
+
+    void play(int voice, SoundId sound, float volume) override;
+    void stop(int voice) override;
+
+private:
+    std::vector<sf::Sound> sounds; // voice * SOUND_COUNT + sound
+    std::vector<int> playing;      // sound each voice last started, -1 for none
+};
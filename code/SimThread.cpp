@@ -0,0 +1,134 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Simulation thread loop.
+ */
+#include "SimThread.h"
+
+#include "Trace.h"
+
+using Clock = std::chrono::steady_clock;
+
+// the render thread and this one already have a core each. with 2 cores or
+// fewer, or an unknown count (0), the centipedes update on this thread
+static int workerCount()
+{
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return cores > 2 ? cores - 2 : 0;
+}
+
+SimThread::SimThread(const WorldConfig& config, std::uint32_t seed, float tickRate, int maxTicksPerFrame)
+    : scheduler(workerCount()), world(config), timestep(tickRate, maxTicksPerFrame), seed(seed), running(false), heldKeys(0),
+      firePresses(0), startPresses(0), phaseTiming(false), ticks(0)
+{
+    world.reset(seed);
+    world.setScheduler(&scheduler);
+
+    // the renderer has a frame before the first tick
+    publish(Clock::now());
+    frames.acquire();
+}
+
+SimThread::~SimThread()
+{
+    stop();
+}
+
+bool SimThread::record(const std::string& path)
+{
+    return recorder.open(path, seed, timestep.getTickDelta(), world.getConfig());
+}
+
+void SimThread::start()
+{
+    if (running.exchange(true)) return;
+    thread = std::thread(&SimThread::run, this);
+}
+
+bool SimThread::stop()
+{
+    running.store(false);
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+    return recorder.close();
+}
+
+void SimThread::setHeldKeys(bool left, bool right, bool up, bool down)
+{
+    InputFrame held;
+    held.left = left;
+    held.right = right;
+    held.up = up;
+    held.down = down;
+    heldKeys.store(packInput(held), std::memory_order_relaxed);
+}
+
+void SimThread::pressFire()
+{
+    firePresses.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SimThread::pressStart()
+{
+    startPresses.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SimThread::setPhaseTiming(bool enable)
+{
+    phaseTiming.store(enable, std::memory_order_relaxed);
+}
+
+void SimThread::publish(Clock::time_point tickTime)
+{
+    TRACE_ZONE("publish");
+    SimFrame& frame = frames.back();
+    world.snapshot(frame.world);
+    frame.tick = ticks.load(std::memory_order_relaxed);
+    frame.time = tickTime;
+    world.takePhaseTimes(frame.phaseSeconds);
+    frames.publish();
+}
+
+void SimThread::run()
+{
+    traceSetThreadName("sim");
+    Clock::time_point last = Clock::now();
+    std::chrono::duration<float> tickDuration(timestep.getTickDelta());
+
+    while (running.load(std::memory_order_relaxed))
+    {
+        Clock::time_point now = Clock::now();
+        int dueTicks = timestep.advance(std::chrono::duration<float>(now - last).count());
+        last = now;
+
+        world.setPhaseTiming(phaseTiming.load(std::memory_order_relaxed));
+        for (int tick = 0; tick < dueTicks; ++tick)
+        {
+            // a press counts for one tick, like a press between two frames did
+            InputFrame input = unpackInput(static_cast<std::uint8_t>(heldKeys.load(std::memory_order_relaxed)));
+            input.fire = firePresses.exchange(0, std::memory_order_relaxed) > 0;
+            input.start = startPresses.exchange(0, std::memory_order_relaxed) > 0;
+
+            recorder.record(input);
+            world.step(timestep.getTickDelta(), input);
+            for (const GameEvent& event : world.getEvents())
+            {
+                events.push(event);
+            }
+            ticks.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // the last tick was due alpha ticks ago
+        std::chrono::duration<float> sinceTick = tickDuration * timestep.getAlpha();
+        if (dueTicks > 0)
+        {
+            publish(now - std::chrono::duration_cast<Clock::duration>(sinceTick));
+        }
+
+        // sleep until the next tick is due
+        std::this_thread::sleep_for(tickDuration - sinceTick);
+    }
+}
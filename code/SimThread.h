@@ -0,0 +1,107 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Runs GameWorld on its own thread at a fixed tick
+ * rate, so a slow frame or a blocking display() never holds up the game.
+ * Every batch of ticks is published as a SimFrame through a triple buffer,
+ * and the render thread draws the newest one without waiting. Input goes
+ * the other way through atomics: held keys are overwritten, key presses
+ * are counted until a tick takes them. Game events go through a ring so
+ * none are lost when the renderer skips a frame.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "FixedTimestep.h"
+#include "GameWorld.h"
+#include "InputLog.h"
+#include "SpscRing.h"
+#include "TaskScheduler.h"
+#include "TripleBuffer.h"
+
+/**
+ * world state after a tick. time is when that tick was due, the renderer
+ * blends toward world by how far it is past it
+ */
+struct SimFrame
+{
+    WorldSnapshot world;
+    std::uint64_t tick = 0;
+    std::chrono::steady_clock::time_point time;
+    double phaseSeconds[PHASE_COUNT] = {}; // summed over the ticks of this frame
+};
+
+class SimThread
+{
+public:
+    SimThread(const WorldConfig& config, std::uint32_t seed, float tickRate = 120.0f, int maxTicksPerFrame = 8);
+    ~SimThread();
+
+    // every tick's input goes to the log, call before start()
+    bool record(const std::string& path);
+
+    void start();
+
+    // waits for the thread and finishes the input log, false if the log failed
+    bool stop();
+
+    // render thread side
+    void setHeldKeys(bool left, bool right, bool up, bool down);
+    void pressFire();
+    void pressStart();
+    void setPhaseTiming(bool enable);
+
+    // newest published frame, never blocks. true if it changed
+    bool acquire()
+    {
+        return frames.acquire();
+    }
+
+    const SimFrame& latest() const
+    {
+        return frames.front();
+    }
+
+    // next event of the ticks run so far, false when there are none left
+    bool popEvent(GameEvent& event)
+    {
+        return events.pop(event);
+    }
+
+    float getTickDelta() const
+    {
+        return timestep.getTickDelta();
+    }
+
+    // ticks run so far
+    std::uint64_t getTicks() const
+    {
+        return ticks.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run();
+    void publish(std::chrono::steady_clock::time_point tickTime);
+
+    TaskScheduler scheduler; // helps with big centipede waves
+    GameWorld world;
+    FixedTimestep timestep;
+    InputRecorder recorder;
+    std::uint32_t seed;
+    TripleBuffer<SimFrame> frames;
+    SpscRing<GameEvent, 1024> events; // full means nobody is listening, extra events are dropped
+
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<unsigned int> heldKeys; // InputBits
+    std::atomic<int> firePresses;
+    std::atomic<int> startPresses;
+    std::atomic<bool> phaseTiming;
+    std::atomic<std::uint64_t> ticks;
+};
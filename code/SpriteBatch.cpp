@@ -0,0 +1,81 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Batched sprite renderer.
+ */
+#include "SpriteBatch.h"
+
+using namespace sf;
+
+void SpriteBatch::clear()
+{
+    for (auto& layer : layers)
+    {
+        layer.quads.clear();
+    }
+}
+
+// a frame uses a handful of textures, linear search is fine
+SpriteBatch::Layer& SpriteBatch::layerFor(const Texture& texture)
+{
+    for (auto& layer : layers)
+    {
+        if (layer.texture == &texture)
+        {
+            return layer;
+        }
+    }
+    layers.push_back({&texture, VertexArray(Quads)});
+    return layers.back();
+}
+
+void SpriteBatch::add(const Texture& texture, float x, float y, float scale)
+{
+    Vector2u size = texture.getSize();
+    add(texture,
+        FloatRect(x, y, size.x * scale, size.y * scale),
+        IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y)));
+}
+
+void SpriteBatch::add(const Texture& texture, const IntRect& source, float x, float y, float scale)
+{
+    add(texture, FloatRect(x, y, source.width * scale, source.height * scale), source);
+}
+
+void SpriteBatch::add(const Texture& texture, const FloatRect& dest, const IntRect& source, const Color& color)
+{
+    VertexArray& quads = layerFor(texture).quads;
+
+    float right = dest.left + dest.width;
+    float bottom = dest.top + dest.height;
+    float sourceRight = static_cast<float>(source.left + source.width);
+    float sourceBottom = static_cast<float>(source.top + source.height);
+
+    quads.append(Vertex(Vector2f(dest.left, dest.top), color, Vector2f(source.left, source.top)));
+    quads.append(Vertex(Vector2f(right, dest.top), color, Vector2f(sourceRight, source.top)));
+    quads.append(Vertex(Vector2f(right, bottom), color, Vector2f(sourceRight, sourceBottom)));
+    quads.append(Vertex(Vector2f(dest.left, bottom), color, Vector2f(source.left, sourceBottom)));
+}
+
+void SpriteBatch::add(const Texture& texture, const VertexArray& source)
+{
+    VertexArray& quads = layerFor(texture).quads;
+    for (std::size_t i = 0; i < source.getVertexCount(); ++i)
+    {
+        quads.append(source[i]);
+    }
+}
+
+void SpriteBatch::draw(RenderTarget& target, RenderStates states)
+{
+    drawCalls = 0;
+    for (const auto& layer : layers)
+    {
+        if (layer.quads.getVertexCount() == 0) continue;
+
+        states.texture = layer.texture;
+        target.draw(layer.quads, states);
+        ++drawCalls;
+    }
+}
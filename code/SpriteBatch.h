@@ -0,0 +1,53 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Collects textured quads and draws them with one
+ * draw call per texture instead of one window.draw() per sprite. Quads of
+ * the same texture keep the order they were added in, textures are drawn in
+ * the order they were first used.
+ */
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class SpriteBatch
+{
+public:
+    // drops the quads from the last frame, keeps the storage
+    void clear();
+
+    // whole texture at (x, y)
+    void add(const sf::Texture& texture, float x, float y, float scale = 1.0f);
+
+    // region of a texture, e.g. an atlas rect, at (x, y)
+    void add(const sf::Texture& texture, const sf::IntRect& source, float x, float y, float scale = 1.0f);
+
+    // part of a texture stretched over dest
+    void add(const sf::Texture& texture, const sf::FloatRect& dest, const sf::IntRect& source,
+             const sf::Color& color = sf::Color::White);
+
+    // prebuilt quads, e.g. a cached tile layer
+    void add(const sf::Texture& texture, const sf::VertexArray& quads);
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default);
+
+    // draw calls issued by the last draw()
+    int getDrawCalls() const
+    {
+        return drawCalls;
+    }
+
+private:
+    struct Layer
+    {
+        const sf::Texture* texture;
+        sf::VertexArray quads;
+    };
+
+    Layer& layerFor(const sf::Texture& texture);
+
+    std::vector<Layer> layers;
+    int drawCalls = 0;
+};
@@ -0,0 +1,50 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Fixed size lock-free queue from one producer
+ * thread to one consumer thread. Unlike the triple buffer nothing is
+ * skipped: every item pushed is popped once, in order, unless the ring was
+ * full and push() refused it. Storage is part of the object, so neither
+ * side ever allocates.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+template <typename T, std::size_t Capacity>
+class SpscRing
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    // producer side, false if the consumer has fallen a whole ring behind
+    bool push(const T& item)
+    {
+        std::size_t head = writeIndex.load(std::memory_order_relaxed);
+        if (head - readIndex.load(std::memory_order_acquire) == Capacity) return false;
+
+        items[head & (Capacity - 1)] = item;
+        writeIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side, false if there is nothing to take
+    bool pop(T& item)
+    {
+        std::size_t tail = readIndex.load(std::memory_order_relaxed);
+        if (tail == writeIndex.load(std::memory_order_acquire)) return false;
+
+        item = items[tail & (Capacity - 1)];
+        readIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T items[Capacity];
+
+    // on their own cache lines, each side writes only one of them
+    alignas(64) std::atomic<std::size_t> writeIndex{0};
+    alignas(64) std::atomic<std::size_t> readIndex{0};
+};
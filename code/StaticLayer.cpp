@@ -0,0 +1,54 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Dirty area tracking for the static layer.
+ */
+#include "StaticLayer.h"
+
+using namespace sf;
+
+// past this many areas one full repaint is cheaper than many small ones
+static const size_t MAX_DIRTY_AREAS = 64;
+
+StaticLayer::StaticLayer()
+    : allDirty(true)
+{
+}
+
+bool StaticLayer::create(unsigned int width, unsigned int height)
+{
+    allDirty = true;
+    dirty.clear();
+    return texture.create(width, height);
+}
+
+void StaticLayer::invalidateAll()
+{
+    allDirty = true;
+    dirty.clear();
+}
+
+void StaticLayer::invalidate(const FloatRect& area)
+{
+    if (allDirty) return;
+
+    // same area twice, e.g. a mushroom hit and then eaten before a flush
+    for (const FloatRect& other : dirty)
+    {
+        if (other == area) return;
+    }
+
+    if (dirty.size() >= MAX_DIRTY_AREAS)
+    {
+        invalidateAll();
+        return;
+    }
+    dirty.push_back(area);
+}
+
+void StaticLayer::draw(RenderTarget& target) const
+{
+    Sprite sprite(texture.getTexture());
+    target.draw(sprite);
+}
@@ -0,0 +1,62 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Offscreen cache for content that rarely changes,
+ * like the background, the black play areas and the mushrooms. The content
+ * is painted into a render texture once and after that only the areas
+ * marked dirty are painted again, so a frame draws the whole static part of
+ * the screen as one quad.
+ */
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class StaticLayer
+{
+public:
+    StaticLayer();
+
+    // false if the render texture could not be created
+    bool create(unsigned int width, unsigned int height);
+
+    // everything is painted again by the next flush()
+    void invalidateAll();
+
+    // area is painted again by the next flush()
+    void invalidate(const sf::FloatRect& area);
+
+    /**
+     * calls paint(target, area) for every dirty area. paint has to cover the
+     * whole area and may not draw outside of it, there is no clipping
+     */
+    template <typename Paint>
+    void flush(Paint paint)
+    {
+        if (!allDirty && dirty.empty()) return;
+
+        if (allDirty)
+        {
+            paint(texture, sf::FloatRect(0.0f, 0.0f, texture.getSize().x, texture.getSize().y));
+        } else
+        {
+            for (const sf::FloatRect& area : dirty)
+            {
+                paint(texture, area);
+            }
+        }
+        texture.display();
+
+        allDirty = false;
+        dirty.clear();
+    }
+
+    // one quad
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    sf::RenderTexture texture;
+    std::vector<sf::FloatRect> dirty;
+    bool allDirty;
+};
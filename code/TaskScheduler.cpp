@@ -0,0 +1,146 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Work-stealing queues and the worker loop.
+ */
+#include "TaskScheduler.h"
+
+#include <algorithm>
+
+#include "Trace.h"
+
+TaskScheduler::TaskScheduler(int workerCount)
+    : queues(workerCount > 0 ? workerCount + 1 : 1), queuedTasks(0), dealCount(0), stopping(false)
+{
+    for (int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void TaskScheduler::run(Job& job, int count, int grain)
+{
+    grain = grain > 0 ? grain : 1;
+    int chunks = (count + grain - 1) / grain;
+    job.remaining.store(chunks, std::memory_order_relaxed);
+
+    // deal the chunks out in turn, neighbouring chunks land on different threads
+    int queueCount = static_cast<int>(queues.size());
+    for (int chunk = 0; chunk < chunks; ++chunk)
+    {
+        Queue& queue = queues[chunk % queueCount];
+        std::lock_guard<std::mutex> lock(queue.lock);
+        queue.tasks.push_back({&job, chunk * grain, std::min(count, (chunk + 1) * grain)});
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepLock);
+        queuedTasks.fetch_add(chunks, std::memory_order_release);
+        dealCount.fetch_add(1, std::memory_order_release);
+    }
+    wake.notify_all();
+
+    // help until every chunk has finished, including the ones other threads took
+    int own = queueCount - 1;
+    while (job.remaining.load(std::memory_order_acquire) > 0)
+    {
+        Task task;
+        if (takeTask(own, task))
+        {
+            execute(task);
+        } else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void TaskScheduler::workerLoop(int index)
+{
+    traceSetThreadName("worker");
+    while (true)
+    {
+        unsigned seen = dealCount.load(std::memory_order_acquire);
+        Task task;
+        if (takeTask(index, task))
+        {
+            execute(task);
+            continue;
+        }
+
+        // queuedTasks stays above 0 while the last chunks are being popped,
+        // so sleep until new chunks are dealt instead of spinning on it
+        std::unique_lock<std::mutex> lock(sleepLock);
+        wake.wait(lock, [this, seen]
+        {
+            return stopping || dealCount.load(std::memory_order_acquire) != seen;
+        });
+        if (stopping) return;
+    }
+}
+
+bool TaskScheduler::popOwn(int index, Task& task)
+{
+    Queue& queue = queues[index];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (queue.tasks.size() == queue.head) return false;
+
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    if (queue.tasks.size() == queue.head)
+    {
+        // keeps the storage, so dealing chunks stops allocating after warm up
+        queue.tasks.clear();
+        queue.head = 0;
+    }
+    return true;
+}
+
+bool TaskScheduler::steal(int index, Task& task)
+{
+    int queueCount = static_cast<int>(queues.size());
+    for (int offset = 1; offset < queueCount; ++offset)
+    {
+        Queue& queue = queues[(index + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(queue.lock);
+        if (queue.tasks.size() == queue.head) continue;
+
+        task = queue.tasks[queue.head++];
+        if (queue.tasks.size() == queue.head)
+        {
+            queue.tasks.clear();
+            queue.head = 0;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool TaskScheduler::takeTask(int index, Task& task)
+{
+    if (queuedTasks.load(std::memory_order_acquire) == 0) return false;
+    if (!popOwn(index, task) && !steal(index, task)) return false;
+
+    queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+void TaskScheduler::execute(const Task& task)
+{
+    TRACE_ZONE("task");
+    task.job->run(task.job->context, task.begin, task.end);
+    task.job->remaining.fetch_sub(1, std::memory_order_release);
+}
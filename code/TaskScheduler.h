@@ -0,0 +1,101 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Small work-stealing thread pool for splitting a
+ * loop across cores. parallelFor() cuts the index range into chunks and
+ * deals them out to one queue per thread. A thread works its own queue from
+ * the back and, once it runs dry, steals from the front of the others, so
+ * uneven chunks even out by themselves. The calling thread works too and
+ * parallelFor() returns when every chunk is done.
+ *
+ * The pool only decides where a chunk runs, never what it computes, so
+ * chunks that write disjoint data give the same result on any core count.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class TaskScheduler
+{
+public:
+    // with 0 workers everything runs on the calling thread
+    explicit TaskScheduler(int workers);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    int getWorkerCount() const
+    {
+        return static_cast<int>(workers.size());
+    }
+
+    /**
+     * calls fn(begin, end) for chunks of at most grain indices covering
+     * [0, count). chunks run on any thread and in any order
+     */
+    template <typename Fn>
+    void parallelFor(int count, int grain, Fn fn)
+    {
+        if (count <= 0) return;
+        if (workers.empty() || count <= grain)
+        {
+            fn(0, count);
+            return;
+        }
+
+        Job job;
+        job.run = [](void* context, int begin, int end)
+        {
+            (*static_cast<Fn*>(context))(begin, end);
+        };
+        job.context = &fn;
+        run(job, count, grain);
+    }
+
+private:
+    struct Job
+    {
+        void (*run)(void* context, int begin, int end);
+        void* context;
+        std::atomic<int> remaining{0};
+    };
+
+    struct Task
+    {
+        Job* job;
+        int begin;
+        int end;
+    };
+
+    // the owner pops from the back, thieves take from head
+    struct Queue
+    {
+        std::mutex lock;
+        std::vector<Task> tasks;
+        size_t head = 0;
+    };
+
+    void run(Job& job, int count, int grain);
+    void workerLoop(int index);
+    bool popOwn(int index, Task& task);
+    bool steal(int index, Task& task);
+    bool takeTask(int index, Task& task);
+    void execute(const Task& task);
+
+    // one queue per worker, the last one belongs to the calling thread
+    std::vector<Queue> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepLock;
+    std::condition_variable wake;
+    std::atomic<int> queuedTasks;
+    // bumped every time run() deals chunks, idle workers wait for a change
+    std::atomic<unsigned> dealCount;
+    bool stopping;
+};
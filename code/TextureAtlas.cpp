@@ -0,0 +1,125 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Shelf packer for the texture atlas.
+ */
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace sf;
+
+// gap between regions so neighbours never bleed in
+static const unsigned int ATLAS_PADDING = 1;
+
+static unsigned int nextPowerOfTwo(unsigned int value)
+{
+    unsigned int power = 1;
+    while (power < value)
+    {
+        power *= 2;
+    }
+    return power;
+}
+
+void TextureAtlas::add(const std::string& name, const Image& image)
+{
+    entries.push_back({name, image, IntRect()});
+}
+
+bool TextureAtlas::build()
+{
+    Image atlas;
+    return pack(atlas) && texture.loadFromImage(atlas);
+}
+
+bool TextureAtlas::pack(Image& atlas)
+{
+    // tallest first keeps the shelves tight
+    std::vector<Entry*> order;
+    unsigned int maxWidth = 0;
+    unsigned int area = 0;
+    for (auto& entry : entries)
+    {
+        Vector2u size = entry.image.getSize();
+        maxWidth = std::max(maxWidth, size.x + ATLAS_PADDING);
+        area += (size.x + ATLAS_PADDING) * (size.y + ATLAS_PADDING);
+        order.push_back(&entry);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const Entry* a, const Entry* b)
+    {
+        return a->image.getSize().y > b->image.getSize().y;
+    });
+
+    unsigned int atlasWidth = nextPowerOfTwo(std::max(maxWidth, static_cast<unsigned int>(std::sqrt(static_cast<float>(area)))));
+
+    // fill shelves left to right, start a new one when a row is full
+    unsigned int x = 0;
+    unsigned int y = 0;
+    unsigned int shelfHeight = 0;
+    for (Entry* entry : order)
+    {
+        Vector2u size = entry->image.getSize();
+        if (x + size.x > atlasWidth)
+        {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        entry->rect = IntRect(static_cast<int>(x), static_cast<int>(y), static_cast<int>(size.x), static_cast<int>(size.y));
+        x += size.x + ATLAS_PADDING;
+        shelfHeight = std::max(shelfHeight, size.y + ATLAS_PADDING);
+    }
+    unsigned int atlasHeight = nextPowerOfTwo(std::max(y + shelfHeight, 1u));
+
+    if (atlasWidth > Texture::getMaximumSize() || atlasHeight > Texture::getMaximumSize())
+    {
+        return false;
+    }
+
+    atlas.create(atlasWidth, atlasHeight, Color::Transparent);
+    for (auto& entry : entries)
+    {
+        if (entry.rect.width > 0 && entry.rect.height > 0)
+        {
+            atlas.copy(entry.image, entry.rect.left, entry.rect.top);
+        }
+        entry.image = Image();
+    }
+    return true;
+}
+
+bool TextureAtlas::loadPacked(const Uint8* pixels, unsigned int width, unsigned int height)
+{
+    if (!texture.create(width, height))
+    {
+        return false;
+    }
+    texture.update(pixels);
+    return true;
+}
+
+void TextureAtlas::addRegion(const std::string& name, const IntRect& rect)
+{
+    entries.push_back({name, Image(), rect});
+}
+
+IntRect TextureAtlas::getRect(const std::string& name) const
+{
+    for (const auto& entry : entries)
+    {
+        if (entry.name == name)
+        {
+            return entry.rect;
+        }
+    }
+    return IntRect();
+}
+
+Vector2u TextureAtlas::getSize(const std::string& name) const
+{
+    IntRect rect = getRect(name);
+    return Vector2u(static_cast<unsigned int>(rect.width), static_cast<unsigned int>(rect.height));
+}
@@ -0,0 +1,69 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Packs every sprite image into one texture at
+ * startup. Sprites then differ only by their texture rect, so switching a
+ * mushroom from Mushroom0 to Mushroom1 is a UV change and the whole
+ * playfield can be drawn from a single texture.
+ */
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * add() images, build() once, then look regions up by name. lookups are
+ * linear so resolve the names at startup and keep the rects
+ */
+class TextureAtlas
+{
+public:
+    void add(const std::string& name, const sf::Image& image);
+
+    // packs the images and uploads the texture, the images are dropped
+    bool build();
+
+    // packs the images into one image without uploading, for the asset pack
+    bool pack(sf::Image& atlasImage);
+
+    /**
+     * an atlas packed ahead of time: the texture is filled straight from
+     * pixels (rgba8) and the regions are added with addRegion()
+     */
+    bool loadPacked(const sf::Uint8* pixels, unsigned int width, unsigned int height);
+    void addRegion(const std::string& name, const sf::IntRect& rect);
+
+    int getRegionCount() const
+    {
+        return static_cast<int>(entries.size());
+    }
+
+    const std::string& getRegionName(int index) const
+    {
+        return entries[index].name;
+    }
+
+    const sf::Texture& getTexture() const
+    {
+        return texture;
+    }
+
+    // empty rect for unknown names
+    sf::IntRect getRect(const std::string& name) const;
+
+    // size of a region in pixels
+    sf::Vector2u getSize(const std::string& name) const;
+
+private:
+    struct Entry
+    {
+        std::string name;
+        sf::Image image;
+        sf::IntRect rect;
+    };
+
+    std::vector<Entry> entries;
+    sf::Texture texture;
+};
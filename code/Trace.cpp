@@ -0,0 +1,131 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Per-thread trace rings and the Chrome trace
+ * writer. A thread takes the registry lock once, the first time it records
+ * with tracing on, to add its ring, so threads that never record cost no
+ * memory. After that only the owning thread writes the ring and publishes
+ * each zone by bumping the ring head. When a ring is full the oldest zones
+ * are overwritten, so a long run keeps its last few seconds.
+ * Dump after the recording threads are done, a zone written during the
+ * dump can come out torn.
+ */
+#include "Trace.h"
+
+#if defined(CENTIPEDE_TRACE) && CENTIPEDE_TRACE
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// zones kept per thread, a power of two
+static const std::uint64_t RING_SIZE = 1 << 17;
+
+struct TraceEvent
+{
+    const char* name;
+    std::uint64_t start;
+    std::uint64_t duration;
+};
+
+struct TraceRing
+{
+    std::vector<TraceEvent> events;
+    std::atomic<std::uint64_t> head{0};
+    int threadId = 0;
+    std::atomic<const char*> threadName{nullptr};
+};
+
+std::atomic<bool> traceActive{false};
+
+static const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+static std::mutex registryMutex;
+static std::vector<std::unique_ptr<TraceRing>> rings;
+static thread_local TraceRing* localRing = nullptr;
+static thread_local const char* localName = nullptr;
+
+// rings live until the program ends so a finished thread can still be dumped
+static TraceRing& threadRing()
+{
+    if (!localRing)
+    {
+        std::unique_ptr<TraceRing> ring(new TraceRing);
+        ring->events.resize(RING_SIZE);
+        ring->threadName.store(localName, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+        ring->threadId = static_cast<int>(rings.size()) + 1;
+        localRing = ring.get();
+        rings.push_back(std::move(ring));
+    }
+    return *localRing;
+}
+
+void traceEnable(bool enable)
+{
+    traceActive.store(enable, std::memory_order_relaxed);
+}
+
+// kept for the ring, which is only made once this thread records
+void traceSetThreadName(const char* name)
+{
+    localName = name;
+    if (localRing)
+    {
+        localRing->threadName.store(name, std::memory_order_release);
+    }
+}
+
+std::uint64_t traceNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceEpoch).count();
+}
+
+void traceRecord(const char* name, std::uint64_t start, std::uint64_t end)
+{
+    TraceRing& ring = threadRing();
+    std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+    ring.events[head & (RING_SIZE - 1)] = {name, start, end - start};
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+bool traceWriteChrome(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::fprintf(file, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (const auto& ring : rings)
+    {
+        const char* threadName = ring->threadName.load(std::memory_order_acquire);
+        if (threadName)
+        {
+            std::fprintf(file, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+                         first ? "" : ",\n", ring->threadId, threadName);
+            first = false;
+        }
+
+        // chrome wants microseconds, the fraction keeps the nanoseconds
+        std::uint64_t head = ring->head.load(std::memory_order_acquire);
+        std::uint64_t oldest = head > RING_SIZE ? head - RING_SIZE : 0;
+        for (std::uint64_t i = oldest; i < head; ++i)
+        {
+            const TraceEvent& event = ring->events[i & (RING_SIZE - 1)];
+            std::fprintf(file, "%s{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                         first ? "" : ",\n", event.name, ring->threadId, event.start / 1000.0, event.duration / 1000.0);
+            first = false;
+        }
+    }
+
+    std::fprintf(file, "\n]}\n");
+    return std::fclose(file) == 0;
+}
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Scoped trace zones. TRACE_ZONE("name") times the
+ * rest of the enclosing block and stores the zone in a ring buffer owned by
+ * the calling thread, so recording never takes a lock. traceWriteChrome()
+ * writes every ring as Chrome trace JSON, which chrome://tracing and
+ * ui.perfetto.dev open directly.
+ *
+ * Zones are compiled in when CENTIPEDE_TRACE is 1 (the CMake option of the
+ * same name) and only record after traceEnable(true). Without the define
+ * TRACE_ZONE expands to nothing.
+ */
+#pragma once
+
+#include <string>
+
+#if defined(CENTIPEDE_TRACE) && CENTIPEDE_TRACE
+
+#include <atomic>
+#include <cstdint>
+
+// names must be string literals, only the pointer is kept
+void traceEnable(bool enable);
+void traceSetThreadName(const char* name);
+
+// nanoseconds since the program started
+std::uint64_t traceNow();
+void traceRecord(const char* name, std::uint64_t start, std::uint64_t end);
+
+// false if the file could not be written
+bool traceWriteChrome(const std::string& path);
+
+extern std::atomic<bool> traceActive;
+
+class TraceZone
+{
+public:
+    explicit TraceZone(const char* name)
+        : name(traceActive.load(std::memory_order_relaxed) ? name : nullptr), start(this->name ? traceNow() : 0)
+    {
+    }
+
+    ~TraceZone()
+    {
+        if (name)
+        {
+            traceRecord(name, start, traceNow());
+        }
+    }
+
+    TraceZone(const TraceZone&) = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+    const char* name;
+    std::uint64_t start;
+};
+
+#define TRACE_JOIN_LINE(name, line) name##line
+#define TRACE_JOIN(name, line) TRACE_JOIN_LINE(name, line)
+#define TRACE_ZONE(name) TraceZone TRACE_JOIN(traceZone, __LINE__)(name)
+
+#else
+
+inline void traceEnable(bool)
+{
+}
+
+inline void traceSetThreadName(const char*)
+{
+}
+
+inline bool traceWriteChrome(const std::string&)
+{
+    return false;
+}
+
+#define TRACE_ZONE(name) ((void)0)
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Lock-free triple buffer for handing whole frames
+ * from one producer thread to one consumer thread. The producer fills the
+ * back slot and publishes it, the consumer picks up the newest published
+ * slot. Neither side ever waits; frames the consumer was too slow for are
+ * skipped. Slots are reused, so a T holding vectors keeps its storage.
+ */
+#pragma once
+
+#include <atomic>
+
+template <typename T>
+class TripleBuffer
+{
+public:
+    // producer side: the slot to fill next
+    T& back()
+    {
+        return slots[backIndex];
+    }
+
+    // producer side: back() becomes the newest frame, a free slot is the new back
+    void publish()
+    {
+        unsigned int previous = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel);
+        backIndex = previous & INDEX;
+    }
+
+    // consumer side: moves to the newest frame, false if nothing new was published
+    bool acquire()
+    {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+
+        unsigned int previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & INDEX;
+        return true;
+    }
+
+    // consumer side: the frame picked up by the last acquire()
+    const T& front() const
+    {
+        return slots[frontIndex];
+    }
+
+private:
+    // the middle index carries a flag saying it has not been picked up yet
+    static const unsigned int INDEX = 3;
+    static const unsigned int FRESH = 4;
+
+    T slots[3];
+    unsigned int backIndex = 0;
+    std::atomic<unsigned int> middle{1};
+    unsigned int frontIndex = 2;
+};
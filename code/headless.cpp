@@ -0,0 +1,324 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Runs the simulation core with no window. A simple
+ * scripted player presses start, wanders and fires so every system gets
+ * exercised. Useful for soak tests and batch runs on machines without a
+ * display. With --replay it instead feeds a recorded input log back
+ * through the same step() path as fast as the CPU allows.
+ *
+ * usage: centipede_headless [--ticks N] [--seed S] [--dt SECONDS] [--mushrooms N]
+ *                           [--centipedes N] [--record FILE] [--replay FILE]
+ *                           [--trace FILE] [--threads N] [--audio 1]
+ *                           [--split-check 1] [--collision-check 1]
+ *
+ * --threads N adds N worker threads for the centipede update. The checksum
+ * does not change with the thread count. --audio 1 feeds the game events
+ * to the audio mixer with the null backend and prints its voice counts.
+ * --split-check 1 shoots a centipede right after its head turned and
+ * checks the rear part keeps crawling the way it was, exit code 1 if not.
+ * --collision-check 1 plays a big wave once per laser collision path and
+ * checks every tick that each one ends in the same state as testing every
+ * segment directly, exit code 1 if not.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AudioMixer.h"
+#include "ECE_Centipede.h"
+#include "GameRandom.h"
+#include "GameWorld.h"
+#include "InputLog.h"
+#include "TaskScheduler.h"
+#include "Trace.h"
+
+/**
+ * a centipede walks into the left edge on an empty field and is shot a
+ * few ticks after its head turned. the rear part has not reached the turn
+ * yet, so it has to keep going left with its particles one body spacing
+ * apart in a row, and still be so a while later
+ */
+static bool checkSplitAfterTurn(const WorldConfig& config, float deltaTime)
+{
+    MushroomField field(Vec2(0.0f, TOP_AREA_HEIGHT), config.mushroomSize, 1, 1);
+    SegmentPool segments;
+    ECE_Centipede centipede(segments, config.headSize, config.bodySize, 8,
+                            Vec2(2.0f * config.bodySize.x, TOP_AREA_HEIGHT), config.centipedeSpeed);
+
+    long ticks = 0;
+    while (centipede.getDirection().x < 0.0f && ticks < 100000)
+    {
+        centipede.update(deltaTime, segments, field);
+        ++ticks;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        centipede.update(deltaTime, segments, field);
+    }
+
+    ECE_Centipede tail = centipede.split(centipede.getFirst() + 2, segments);
+    bool ok = tail.getDirection().x < 0.0f;
+    for (int tick = 0; tick <= 20 && ok; ++tick)
+    {
+        for (int i = tail.getFirst() + 1; i < tail.getFirst() + tail.getCount(); ++i)
+        {
+            float spacing = segments.x[i] - segments.x[i - 1];
+            if (std::fabs(spacing - config.bodySize.x) > 0.01f || segments.y[i] != segments.y[i - 1])
+            {
+                ok = false;
+            }
+        }
+        tail.update(deltaTime, segments, field);
+    }
+
+    std::cout << "split after turn: " << (ok ? "ok" : "FAILED") << std::endl;
+    return ok;
+}
+
+/**
+ * the same scripted game runs in one world per collision path, firing
+ * every tick into a wave of at least 200 centipedes so lasers hit segments
+ * on most ticks and the count in flight crosses every threshold. after
+ * each tick every world has to hash the same as the direct one
+ */
+static bool checkCollisionPaths(WorldConfig config, std::uint32_t seed, float deltaTime, long ticks)
+{
+    const CollisionPath paths[] = {COLLISION_DIRECT, COLLISION_AUTO, COLLISION_BATCH, COLLISION_BROADPHASE};
+    const char* const names[] = {"direct", "auto", "batch", "broadphase"};
+    const int pathCount = 4;
+
+    config.centipedeCount = std::max(config.centipedeCount, 200);
+    std::vector<GameWorld> worlds(pathCount, GameWorld(config));
+    for (int p = 0; p < pathCount; ++p)
+    {
+        worlds[p].reset(seed);
+        worlds[p].setCollisionPath(paths[p]);
+    }
+
+    GameRandom botGen(seed);
+    int heldKeys = 0;
+    long ticksPerChoice = static_cast<long>(0.5f / deltaTime) + 1;
+    int mostLasers = 0;
+    bool ok = true;
+    for (long tick = 0; tick < ticks && ok; ++tick)
+    {
+        if (tick % ticksPerChoice == 0)
+        {
+            heldKeys = botGen.nextInt(0, 15);
+        }
+        InputFrame input;
+        input.left = (heldKeys & 1) != 0;
+        input.right = (heldKeys & 2) != 0;
+        input.up = (heldKeys & 4) != 0;
+        input.down = (heldKeys & 8) != 0;
+        input.fire = true;
+        input.start = !worlds[0].isStarted();
+
+        for (GameWorld& world : worlds)
+        {
+            world.step(deltaTime, input);
+        }
+        mostLasers = std::max(mostLasers, worlds[0].getLaserCount());
+
+        std::uint64_t expected = worlds[0].checksum();
+        for (int p = 1; p < pathCount; ++p)
+        {
+            if (worlds[p].checksum() != expected)
+            {
+                std::cout << "collision paths: " << names[p] << " differs from direct at tick " << tick << std::endl;
+                ok = false;
+            }
+        }
+    }
+
+    if (ok)
+    {
+        std::cout << "collision paths: ok, up to " << mostLasers << " lasers, score " << worlds[0].getScore()
+                  << std::endl;
+    }
+    return ok;
+}
+
+int main(int argc, char* argv[])
+{
+    long ticks = 100000;
+    std::uint32_t seed = 1;
+    float deltaTime = 1.0f / 120.0f;
+    WorldConfig config;
+    std::string recordPath;
+    std::string replayPath;
+    std::string tracePath;
+    int threads = 0;
+    bool audio = false;
+    bool splitCheck = false;
+    bool collisionCheck = false;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--ticks") == 0)
+        {
+            ticks = std::strtol(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--seed") == 0)
+        {
+            seed = static_cast<std::uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--dt") == 0)
+        {
+            deltaTime = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--mushrooms") == 0)
+        {
+            config.mushroomCount = static_cast<int>(std::strtol(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--centipedes") == 0)
+        {
+            config.centipedeCount = static_cast<int>(std::strtol(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--record") == 0)
+        {
+            recordPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--replay") == 0)
+        {
+            replayPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--trace") == 0)
+        {
+            tracePath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--audio") == 0)
+        {
+            audio = std::strtol(argv[i + 1], nullptr, 10) != 0;
+        } else if (std::strcmp(argv[i], "--split-check") == 0)
+        {
+            splitCheck = std::strtol(argv[i + 1], nullptr, 10) != 0;
+        } else if (std::strcmp(argv[i], "--collision-check") == 0)
+        {
+            collisionCheck = std::strtol(argv[i + 1], nullptr, 10) != 0;
+        } else if (std::strcmp(argv[i], "--threads") == 0)
+        {
+            threads = static_cast<int>(std::strtol(argv[i + 1], nullptr, 10));
+        } else
+        {
+            std::cerr << "unknown option " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    if (splitCheck)
+    {
+        return checkSplitAfterTurn(config, deltaTime) ? 0 : 1;
+    }
+    if (collisionCheck)
+    {
+        return checkCollisionPaths(config, seed, deltaTime, std::min(ticks, 3000L)) ? 0 : 1;
+    }
+
+    // a replay brings its own seed, tick length and config
+    InputReplay replay;
+    if (!replayPath.empty())
+    {
+        if (!replay.open(replayPath))
+        {
+            std::cerr << "could not read input log " << replayPath << std::endl;
+            return 1;
+        }
+        seed = replay.getSeed();
+        deltaTime = replay.getTickDelta();
+        config = replay.getConfig();
+        ticks = replay.getTickCount();
+    }
+
+    NullAudioBackend audioBackend;
+    AudioMixer mixer(audioBackend);
+
+    TaskScheduler scheduler(threads);
+    GameWorld world(config);
+    world.reset(seed);
+    world.setScheduler(&scheduler);
+
+    InputRecorder recorder;
+    if (!recordPath.empty() && !recorder.open(recordPath, seed, deltaTime, config))
+    {
+        std::cerr << "could not write input log " << recordPath << std::endl;
+        return 1;
+    }
+
+    // scripted player, picks a new held direction every half second of game time
+    GameRandom botGen(seed);
+    int heldKeys = 0;
+    long ticksPerChoice = static_cast<long>(0.5f / deltaTime) + 1;
+    long ticksPerShot = static_cast<long>(0.1f / deltaTime) + 1;
+
+    if (!tracePath.empty())
+    {
+        traceSetThreadName("main");
+        traceEnable(true);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (long tick = 0; tick < ticks; ++tick)
+    {
+        InputFrame input;
+        if (!replayPath.empty())
+        {
+            replay.next(input);
+        } else
+        {
+            if (tick % ticksPerChoice == 0)
+            {
+                heldKeys = botGen.nextInt(0, 15);
+            }
+            input.left = (heldKeys & 1) != 0;
+            input.right = (heldKeys & 2) != 0;
+            input.up = (heldKeys & 4) != 0;
+            input.down = (heldKeys & 8) != 0;
+            input.fire = tick % ticksPerShot == 0;
+            input.start = !world.isStarted();
+        }
+
+        recorder.record(input);
+        world.step(deltaTime, input);
+
+        if (audio)
+        {
+            for (const GameEvent& event : world.getEvents())
+            {
+                mixer.playEvent(event);
+            }
+            mixer.update(deltaTime);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    if (!recorder.close())
+    {
+        std::cerr << "could not finish input log " << recordPath << std::endl;
+        return 1;
+    }
+
+    // the ring keeps the last zones of a long run
+    if (!tracePath.empty() && !traceWriteChrome(tracePath))
+    {
+        std::cerr << "could not write trace " << tracePath << " (built without CENTIPEDE_TRACE?)" << std::endl;
+    }
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "ticks: " << ticks << "\n"
+              << "threads: " << threads << "\n"
+              << "seconds: " << seconds << "\n"
+              << "ticks/sec: " << (seconds > 0.0 ? ticks / seconds : 0.0) << "\n"
+              << "score: " << world.getScore() << "\n"
+              << "lives: " << world.getLives() << "\n"
+              << "checksum: " << std::hex << world.checksum() << std::dec << std::endl;
+
+    if (audio)
+    {
+        const MixerStats& stats = mixer.getStats();
+        std::cout << "sounds played: " << stats.played << "\n"
+                  << "voices stolen: " << stats.stolen << "\n"
+                  << "sounds dropped: " << stats.dropped << std::endl;
+    }
+
+    return 0;
+}
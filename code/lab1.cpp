@@ -1,776 +1,532 @@
-/**
- * Author: Leandro Alan Kim
- * Class: ECE4122 Section A
- * Turn in Date : 30 Sep 2024
- * 
- * Description and Purpose: This project is the recreation of the Retro Centipede
- * Arcade Game by applying the principles of 2D graphics and class creation in C++.
- * Using Cmake and SFML was the key concept of this project in reproducing the game 
- * play that supported the first level of Centipede Arcade Game.
- */
-#include <SFML/Graphics.hpp>
-#include <vector>
-#include <list>
-#include <cmath>
-#include <random>
-#include <iostream>
-
-using namespace sf;
-
-// dividing the top info area, main game area, and mushroom free area
-const int WIDTH = 800;
-const int HEIGHT = 600;
-const int TOP_AREA_HEIGHT = 50;
-const int BOTTOM_AREA_HEIGHT = 50;
-const int MAIN_AREA_HEIGHT = HEIGHT - TOP_AREA_HEIGHT - BOTTOM_AREA_HEIGHT;
-
-/**
- * mushroom struct
- */
-struct Mushroom
-{
-    Sprite sprite;
-    int health;
-};
-
-/**
- * ECE_LaserBlast class derived from the SFML::Sprite.
- * initializes the textture, positoin, and speed.
- * moves the laser upwards
- * collision check returns true if there is a collision
- */
-class ECE_LaserBlast : public Sprite
-{
-public:
-    ECE_LaserBlast(const Texture& texture, const Vector2f& position, float speed)
-        : speed(speed)
-    {
-        setTexture(texture);
-        setPosition(position);
-    }
-
-    void update(float deltaTime)
-    {
-        move(0.0f, -speed * deltaTime); // laser going up
-    }
-
-    // returns true if collision is found
-    bool checkCollision(const Sprite& other)
-    {
-        return getGlobalBounds().intersects(other.getGlobalBounds());
-    }
-
-private:
-    float speed;
-};
-
-// centipede struct
-struct CentipedeParticle
-{
-    Sprite sprite;
-};
-
-// function to normalize a vector
-Vector2f normalize(Vector2f v)
-{
-    float mag = std::sqrt(v.x * v.x + v.y * v.y);
-    if (mag == 0) return Vector2f(0, 0);
-    return Vector2f(v.x / mag, v.y / mag);
-}
-
-/**
- * constuctor initializes head and body and positions them accordingly.
- * update method moves the head and updates on collisions
- * body particles foolows the head
- */
-class ECE_Centipede
-{
-public:
-    // constructor
-    ECE_Centipede(const Texture& headTexture, const Texture& bodyTexture, int numParticles, Vector2f startPosition, float speed)
-        : headTexture(headTexture), bodyTexture(bodyTexture), speed(speed), alive(true)
-    {
-        direction = Vector2f(-1.0f, 0.0f); // starts out moving to the left
-
-        // head particle
-        CentipedeParticle headParticle;
-        headParticle.sprite.setTexture(headTexture);
-        headParticle.sprite.setPosition(startPosition);
-        particles.push_back(headParticle);
-
-        // body particles is following the head
-        for (int i = 1; i < numParticles; ++i)
-        {
-            CentipedeParticle bodyParticle;
-            bodyParticle.sprite.setTexture(bodyTexture);
-            bodyParticle.sprite.setPosition(startPosition.x + i * bodyTexture.getSize().x, startPosition.y);
-            particles.push_back(bodyParticle);
-        }
-    }
-
-    // Update method
-    void update(float deltaTime, const std::list<Mushroom>& mushrooms)
-    {
-        if (!alive) return;
-
-        Vector2f movement = direction * speed * deltaTime;
-        particles[0].sprite.move(movement); // move head
-
-        // check head collision
-        Sprite& head = particles[0].sprite;
-
-        float leftBound = 0.0f;
-        float rightBound = WIDTH - head.getTexture()->getSize().x;
-
-        bool changeDirection = false;
-
-        // Check screen edge collision
-        if (head.getPosition().x <= leftBound || head.getPosition().x >= rightBound)
-        {
-            changeDirection = true;
-        }
-
-        // Check collision with mushroom
-        for (const Mushroom& mushroom : mushrooms)
-        {
-            if (head.getGlobalBounds().intersects(mushroom.sprite.getGlobalBounds()))
-            {
-                changeDirection = true;
-                break;
-            }
-        }
-
-        if (changeDirection)
-        {
-            direction.x = -direction.x; // change directions
-            head.move(0.0f, head.getTexture()->getSize().y); // move head down
-        }
-
-        // body following the head
-        for (size_t i = 1; i < particles.size(); ++i)
-        {
-            Vector2f dir = (particles[i - 1].sprite.getPosition()) - (particles[i].sprite.getPosition());
-            float dist = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-
-            if (dist > bodyTexture.getSize().x)
-            {
-                dir = normalize(dir);
-                particles[i].sprite.move(dir * speed * deltaTime);
-            }
-        }
-    }
-
-    // draw method
-    void draw(RenderWindow& window) const
-    {
-        if (!alive) return;
-
-        for (const auto& particle : particles)
-        {
-            window.draw(particle.sprite);
-        }
-    }
-
-    // check if centipede is alive
-    bool isAlive() const 
-    {
-        return alive;
-    }
-
-private:
-    std::vector<CentipedeParticle> particles;
-    Vector2f direction;
-    float speed;
-    bool alive;
-    const Texture& headTexture;
-    const Texture& bodyTexture;
-};
-
-int main() {
-    VideoMode vm(WIDTH, HEIGHT);
-    RenderWindow window(vm, "Centipede Game");
-
-    // start screen texture
-    Texture textureBackground;
-    textureBackground.loadFromFile("graphics/Background.png");
-
-    // mushroom0 texture
-    Texture mushroom0Texture;
-    mushroom0Texture.loadFromFile("graphics/Mushroom0.png");
-    
-    // mushroom1 texture
-    Texture mushroom1Texture;
-    mushroom1Texture.loadFromFile("graphics/Mushroom1.png");
-
-    // starship texture
-    Texture starshipTexture;
-    starshipTexture.loadFromFile("graphics/StarShip.png");
-
-    // spider texture
-    Texture spiderTexture;
-    spiderTexture.loadFromFile("graphics/Spider.png");
-
-    // centipede head texture
-    Texture cHeadTexture;
-    cHeadTexture.loadFromFile("graphics/CentipedeHead.png");
-
-    // centipede body texture
-    Texture cBodyTexture;
-    cBodyTexture.loadFromFile("graphics/CentipedeBody.png");
-
-    // centipede instance created
-    std::vector<ECE_Centipede> centipedes;
-
-    int centipedeLength = 12; // 1 head and 11 body
-
-    // set starting position at the right corner of top info area
-    Vector2f centipedeStartPosition(
-        WIDTH - cHeadTexture.getSize().x,
-        TOP_AREA_HEIGHT
-    );
-
-    float centipedeSpeed = 100.0f; // speed of centipede
-
-    ECE_Centipede initialCentipede(
-        cHeadTexture,
-        cBodyTexture,
-        centipedeLength,
-        centipedeStartPosition,
-        centipedeSpeed
-    );
-
-    centipedes.push_back(initialCentipede);
-
-    // red laser texture
-    Texture laserTexture;
-    Image laser;
-    laser.create(2, 15, Color::Red);
-    laserTexture.loadFromImage(laser);
-
-    int mushroomWidth = mushroom0Texture.getSize().x;
-    int mushroomHeight = mushroom0Texture.getSize().y;
-
-    // start screen sprite
-    Sprite spriteBackground;
-    spriteBackground.setTexture(textureBackground);
-    spriteBackground.setPosition(0, 0);
-
-    // top information area
-    RectangleShape topArea(Vector2f(WIDTH, TOP_AREA_HEIGHT));
-    topArea.setFillColor(Color::Black);
-
-    // mushroom free area
-    RectangleShape bottomArea(Vector2f(WIDTH, BOTTOM_AREA_HEIGHT));
-    bottomArea.setPosition(0, HEIGHT - BOTTOM_AREA_HEIGHT);
-    bottomArea.setFillColor(Color::Black);
-
-    // main game area
-    RectangleShape mainArea(Vector2f(WIDTH, MAIN_AREA_HEIGHT));
-    mainArea.setPosition(0, TOP_AREA_HEIGHT);
-    mainArea.setFillColor(Color::Black);
-
-    bool gameStarted = false;
-
-    // random number generator
-    std::random_device rd;
-    std::mt19937 gen(rd());
-
-    //mushroom placement boundaries are set in the main game area
-    float mushroomBottomLimit = HEIGHT - BOTTOM_AREA_HEIGHT - 2 * mushroomHeight;
-    std::uniform_int_distribution<> disX(0, WIDTH - mushroomWidth);
-    std::uniform_int_distribution<> disY(TOP_AREA_HEIGHT, static_cast<int>(mushroomBottomLimit - mushroomHeight));
-
-    // 30 random mushrooms
-    std::list<Mushroom> mushrooms;
-    for (int i = 0; i < 30; ++i)
-    {
-        Mushroom m;
-        m.sprite.setTexture(mushroom0Texture);
-        m.health = 2; // mushroom0 and mushroom1
-        int x = disX(gen);
-        int y = disY(gen);
-        m.sprite.setPosition(x, y);
-        mushrooms.push_back(m);
-    }
-
-    // starship sprite
-    Sprite starshipSprite;
-    starshipSprite.setTexture(starshipTexture);
-
-    // starting position middle bottom 
-    float starshipX = (WIDTH - starshipTexture.getSize().x) / 2.0f;
-    float starshipY = HEIGHT - BOTTOM_AREA_HEIGHT - starshipTexture.getSize().y;
-    starshipSprite.setPosition(starshipX, starshipY);
-    const float starshipSpeed = 300.0f;
-
-    const float laserSpeed = 500.0f;
-    std::list<ECE_LaserBlast> shootLaser;
-
-    // spider sprite
-    Sprite spiderSprite;
-    spiderSprite.setTexture(spiderTexture);
-
-    // starting position
-    float spiderX = WIDTH / 2.0f;
-    float spiderY = TOP_AREA_HEIGHT + MAIN_AREA_HEIGHT / 2.0f;
-    spiderSprite.setPosition(spiderX, spiderY);
-
-    // spider movement
-    float spiderSpeed = 250.0f;
-    Vector2f spiderDirection(1.0f, 0.0f);
-    float spiderChangeDirectionTime = 0.0f;
-    float spiderDirectionChangeInterval = 1.0f;
-    bool spiderActive = true;
-    float spiderRespawnTimer = 0.0f;
-    const float spiderRespawnInterval = 5.0f; // respawn
-
-    // starship life
-    int lives = 3;
-    Vector2f starshipStartPosition = starshipSprite.getPosition();
-    std::vector<Sprite> life;
-
-    // font
-    Font font;
-    font.loadFromFile("fonts/KOMIKAP_.ttf");
-
-    // player score
-    int score = 0;
-    Text scoreText;
-    scoreText.setFont(font);
-    scoreText.setCharacterSize(36);
-    scoreText.setFillColor(Color::White);
-    scoreText.setString(std::to_string(score));
-
-    // score at the middle of info area
-    FloatRect scoreTextRect = scoreText.getLocalBounds();
-    scoreText.setOrigin(scoreTextRect.left + scoreTextRect.width / 2.0f,
-                        scoreTextRect.top + scoreTextRect.height / 2.0f);
-    scoreText.setPosition(WIDTH / 2.0f, TOP_AREA_HEIGHT / 2.0f);
-
-    // life icons on the right side of info area
-    auto updateLifeIcons = [&]()
-    {
-        life.clear();
-        float lifeIconWidth = lives * (starshipTexture.getSize().x * 0.5f + 5) - 5;
-        float livesStartX = WIDTH - lifeIconWidth - 10.0f;
-        float lifeIconY = (TOP_AREA_HEIGHT - starshipTexture.getSize().y * 0.5f) / 2.0f;
-
-        for (int i = 0; i < lives; ++i)
-        {
-            Sprite lifeIcon;
-            lifeIcon.setTexture(starshipTexture);
-            lifeIcon.setScale(0.5f, 0.5f);
-            lifeIcon.setPosition(livesStartX + i * (starshipTexture.getSize().x * 0.5f + 5), lifeIconY);
-            life.push_back(lifeIcon);
-        }
-    };
-    updateLifeIcons();
-
-    Clock clock;
-
-    // main loop
-    while (window.isOpen())
-    {
-        // delta time for smooth movement
-        float deltaTime = clock.restart().asSeconds();
-
-        // events handlers
-        Event event;
-        while (window.pollEvent(event))
-        {
-            if (event.type == Event::Closed)
-            {
-                window.close();
-            }
-            if (event.type == Event::KeyPressed && event.key.code == Keyboard::Escape)
-            {
-                window.close(); // close on escape
-            }
-            if (event.type == Event::KeyPressed && event.key.code == Keyboard::Enter)
-            {
-                gameStarted = true; // start game on enter
-            }
-            // shoot laser on space button. position is at the tip of the startship
-            if (gameStarted && event.type == Event::KeyPressed && event.key.code == Keyboard::Space)
-            {
-                Vector2f starshipPosition = starshipSprite.getPosition();
-                float starshipWidth = starshipTexture.getSize().x;
-                Vector2f laserPosition(
-                    starshipPosition.x + starshipWidth / 2.0f - laserTexture.getSize().x / 2.0f,
-                    starshipPosition.y - laserTexture.getSize().y
-                );
-                // new laser blast
-                ECE_LaserBlast laser(laserTexture, laserPosition, laserSpeed);
-                // add to list
-                shootLaser.push_back(laser);
-            }
-        }
-
-        if (gameStarted) {
-            // starship movement with left, right, up, down key
-            float moveX = 0.0f;
-            float moveY = 0.0f;
-            if (Keyboard::isKeyPressed(Keyboard::Left))
-            {
-                moveX -= starshipSpeed * deltaTime;
-            }
-            if (Keyboard::isKeyPressed(Keyboard::Right))
-            {
-                moveX += starshipSpeed * deltaTime;
-            }
-            if (Keyboard::isKeyPressed(Keyboard::Up))
-            {
-                moveY -= starshipSpeed * deltaTime;
-            }
-            if (Keyboard::isKeyPressed(Keyboard::Down))
-            {
-                moveY += starshipSpeed * deltaTime;
-            }
-
-            Vector2f position = starshipSprite.getPosition();
-
-            // boundaries for starship
-            float leftBound = 0.0f;
-            float rightBound = WIDTH - starshipTexture.getSize().x;
-            float lowerBound = HEIGHT - BOTTOM_AREA_HEIGHT - starshipTexture.getSize().y;
-            float upperBound = lowerBound - (MAIN_AREA_HEIGHT * 0.25f);
-
-            // collision on x
-            Vector2f newPosition = position;
-            newPosition.x += moveX;
-            FloatRect starshipBounds = starshipSprite.getGlobalBounds();
-            starshipBounds.left = newPosition.x;
-
-            bool collisionX = false;
-            for (const auto& mushroom : mushrooms)
-            {
-                if (starshipBounds.intersects(mushroom.sprite.getGlobalBounds()))
-                {
-                    collisionX = true;
-                    break;
-                }
-            }
-
-            if (!collisionX) {
-                position.x = newPosition.x;
-            }
-
-            // collision on y
-            newPosition = position;
-            newPosition.y += moveY;
-            starshipBounds.top = newPosition.y;
-
-            bool collisionY = false;
-            for (const auto& mushroom : mushrooms)
-            {
-                if (starshipBounds.intersects(mushroom.sprite.getGlobalBounds()))
-                {
-                    collisionY = true;
-                    break;
-                }
-            }
-
-            if (!collisionY)
-            {
-                position.y = newPosition.y;
-            }
-
-            // boundaries set at .25 from the bottom
-            if (position.x < leftBound)
-            {
-                position.x = leftBound;
-            }
-            if (position.x > rightBound)
-            {
-                position.x = rightBound;
-            }
-            if (position.y < upperBound)
-            {
-                position.y = upperBound;
-            }
-            if (position.y > lowerBound)
-            {
-                position.y = lowerBound;
-            }
-            starshipSprite.setPosition(position);
-
-            // update laser blasts when outof bounds
-            for (auto it = shootLaser.begin(); it != shootLaser.end();)
-            {
-                it->update(deltaTime);
-                if (it->getPosition().y + it->getGlobalBounds().height < 0)
-                {
-                    it = shootLaser.erase(it);
-                } else
-                {
-                    ++it;
-                }
-            }
-
-            // laser hitting mushroom and spider
-            for (auto laserIt = shootLaser.begin(); laserIt != shootLaser.end();)
-            {
-                bool laserRemoved = false;
-
-                // mushroom collision
-                for (auto mushroomIt = mushrooms.begin(); mushroomIt != mushrooms.end();)
-                {
-                    if (laserIt->checkCollision(mushroomIt->sprite))
-                    {
-                        mushroomIt->health--; // to mushroom1
-
-                        if (mushroomIt->health == 1)
-                        {
-                            mushroomIt->sprite.setTexture(mushroom1Texture); // change texture to mushrrom1
-                        }
-
-                        // if mushroom1 is hit again then it is gone
-                        if (mushroomIt->health <= 0)
-                        {
-                            score += 4; // killing mushroom is 4 points
-
-                            // score update
-                            scoreText.setString(std::to_string(score));
-                            FloatRect scoreTextRect = scoreText.getLocalBounds();
-                            scoreText.setOrigin(scoreTextRect.left + scoreTextRect.width / 2.0f,
-                                                scoreTextRect.top + scoreTextRect.height / 2.0f);
-                            scoreText.setPosition(WIDTH / 2.0f, TOP_AREA_HEIGHT / 2.0f);
-
-                            mushroomIt = mushrooms.erase(mushroomIt);
-                        } else
-                        {
-                            ++mushroomIt;
-                        }
-
-                        // erase laser after hitting
-                        laserIt = shootLaser.erase(laserIt);
-                        laserRemoved = true;
-                        break;
-                    } else 
-                    {
-                        ++mushroomIt;
-                    }
-                }
-
-                if (!laserRemoved)
-                {
-                    // spider collision
-                    if (spiderActive && laserIt->checkCollision(spiderSprite))
-                    {
-                        spiderActive = false; // remove spider
-                        spiderRespawnTimer = 0.0f;
-                        score += 500; // killing the spider is 500 points
-
-                        // score update
-                        scoreText.setString(std::to_string(score));
-                        FloatRect scoreTextRect = scoreText.getLocalBounds();
-                        scoreText.setOrigin(scoreTextRect.left + scoreTextRect.width / 2.0f,
-                                            scoreTextRect.top + scoreTextRect.height / 2.0f);
-                        scoreText.setPosition(WIDTH / 2.0f, TOP_AREA_HEIGHT / 2.0f);
-
-                        // erase laser after hitting
-                        laserIt = shootLaser.erase(laserIt);
-                        laserRemoved = true;
-                    } else
-                    {
-                        ++laserIt;
-                    }
-                }
-            }
-
-            // spider update
-            if (spiderActive)
-            {
-                spiderChangeDirectionTime += deltaTime;
-
-                if (spiderChangeDirectionTime >= spiderDirectionChangeInterval)
-                {
-                    spiderChangeDirectionTime = 0.0f;
-                    // random direction
-                    std::uniform_real_distribution<float> disDir(-1.0f, 1.0f);
-                    float dirX = disDir(gen);
-                    float dirY = disDir(gen);
-                    // normalize vector
-                    float magnitude = std::sqrt(dirX * dirX + dirY * dirY);
-                    if (magnitude != 0) {
-                        spiderDirection.x = dirX / magnitude;
-                        spiderDirection.y = dirY / magnitude;
-                    }
-                }
-                spiderSprite.move(spiderDirection.x * spiderSpeed * deltaTime,
-                                    spiderDirection.y * spiderSpeed * deltaTime); // spider movement
-
-                // spider boundaries
-                Vector2f spiderPosition = spiderSprite.getPosition();
-                float spiderLeftBound = 0.0f;
-                float spiderRightBound = WIDTH - spiderTexture.getSize().x;
-                float spiderUpperBound = TOP_AREA_HEIGHT;
-                float spiderLowerBound = TOP_AREA_HEIGHT + MAIN_AREA_HEIGHT - spiderTexture.getSize().y;
-
-                if (spiderPosition.x < spiderLeftBound)
-                {
-                    spiderPosition.x = spiderLeftBound;
-                    spiderDirection.x = -spiderDirection.x;
-                }
-                if (spiderPosition.x > spiderRightBound)
-                {
-                    spiderPosition.x = spiderRightBound;
-                    spiderDirection.x = -spiderDirection.x;
-                }
-                if (spiderPosition.y < spiderUpperBound)
-                {
-                    spiderPosition.y = spiderUpperBound;
-                    spiderDirection.y = -spiderDirection.y;
-                }
-                if (spiderPosition.y > spiderLowerBound)
-                {
-                    spiderPosition.y = spiderLowerBound;
-                    spiderDirection.y = -spiderDirection.y;
-                }
-                spiderSprite.setPosition(spiderPosition);
-
-                // when spider hits mushroom
-                for (auto mushroomIt = mushrooms.begin(); mushroomIt != mushrooms.end(); )
-                {
-                    // mushroom is removed
-                    if (spiderSprite.getGlobalBounds().intersects(mushroomIt->sprite.getGlobalBounds()))
-                    {
-                        mushroomIt = mushrooms.erase(mushroomIt);
-                    } else 
-                    {
-                        ++mushroomIt;
-                    }
-                }
-
-                // when spider hits starship
-                if (spiderSprite.getGlobalBounds().intersects(starshipSprite.getGlobalBounds()))
-                {
-                    // starship starts again at the starting position
-                    starshipSprite.setPosition(starshipStartPosition);
-                    lives--; // lose one life
-
-                    // when all 3 lives are used reset
-                    if (lives == 0)
-                    {
-                        gameStarted = false;
-                        lives = 3; // reset life
-                        starshipSprite.setPosition(starshipStartPosition); // starship back to starting position
-                        spiderSprite.setPosition(spiderX, spiderY); // spider back to starting position
-                        spiderActive = true;
-                        spiderRespawnTimer = 0.0f;
-
-                        // reset score
-                        score = 0;
-                        scoreText.setString(std::to_string(score));
-                        FloatRect scoreTextRect = scoreText.getLocalBounds();
-                        scoreText.setOrigin(scoreTextRect.left + scoreTextRect.width / 2.0f,
-                                            scoreTextRect.top + scoreTextRect.height / 2.0f);
-                        scoreText.setPosition(WIDTH / 2.0f, TOP_AREA_HEIGHT / 2.0f);
-
-                        // reset 30 mushrooms
-                        mushrooms.clear();
-                        for (int i = 0; i < 30; ++i)
-                        {
-                            Mushroom m;
-                            m.sprite.setTexture(mushroom0Texture);
-                            m.health = 2; // mushroom0 and mushroom1
-                            int x = disX(gen);
-                            int y = disY(gen);
-                            m.sprite.setPosition(x, y);
-                            mushrooms.push_back(m);
-                        }
-
-                        // reset laser
-                        shootLaser.clear();
-
-                        // reset centipede
-                        centipedes.clear();
-                        ECE_Centipede newCentipede(
-                            cHeadTexture,
-                            cBodyTexture,
-                            centipedeLength,
-                            centipedeStartPosition,
-                            centipedeSpeed
-                        );
-                        centipedes.push_back(newCentipede);
-                    }
-                    // reset life
-                    updateLifeIcons();
-                }
-            } else
-            {
-                // reset spider at random position
-                spiderRespawnTimer += deltaTime;
-                if (spiderRespawnTimer >= spiderRespawnInterval)
-                {
-                    spiderActive = true; // respawn
-                    spiderRespawnTimer = 0.0f;
-                    std::uniform_int_distribution<> disSpiderX(0, WIDTH - spiderTexture.getSize().x);
-                    std::uniform_int_distribution<> disSpiderY(TOP_AREA_HEIGHT, TOP_AREA_HEIGHT + MAIN_AREA_HEIGHT - spiderTexture.getSize().y);
-                    float newSpiderX = disSpiderX(gen);
-                    float newSpiderY = disSpiderY(gen);
-                    spiderSprite.setPosition(newSpiderX, newSpiderY);
-                }
-            }
-            // update centipedes
-            for (auto& centipede : centipedes)
-            {
-                centipede.update(deltaTime, mushrooms);
-            }
-        }
-
-        // rendering
-        window.clear();
-        window.draw(spriteBackground);
-
-        if (!gameStarted)
-        {
-            window.draw(spriteBackground); // start screen
-        } else
-        {
-            window.draw(mainArea);
-            window.draw(topArea);
-            window.draw(bottomArea);
-
-            // draw mushroom
-            for (const auto& mushroom : mushrooms)
-            {
-                window.draw(mushroom.sprite);
-            }
-
-            // draw centipedes
-            for (const auto& centipede : centipedes)
-            {
-                centipede.draw(window);
-            }
-
-            // draw laser
-            for (const auto& laser : shootLaser)
-            {
-                window.draw(laser);
-            }
-
-            // draw spider
-            if (spiderActive)
-            {
-                window.draw(spiderSprite);
-            }
-
-            // draw starship
-            window.draw(starshipSprite);
-
-            // draw score
-            window.draw(scoreText);
-
-            // draw life icon
-            for (const auto& icon : life)
-            {
-                window.draw(icon);
-            }
-        }
-
-        window.display();
-    }
-
-    return 0;
-}
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ * Turn in Date : 30 Sep 2024
+ * 
+ * Description and Purpose: This project is the recreation of the Retro Centipede
+ * Arcade Game by applying the principles of 2D graphics and class creation in C++.
+ * Using Cmake and SFML was the key concept of this project in reproducing the game 
+ * play that supported the first level of Centipede Arcade Game.
+ *
+ * The game rules live in GameWorld, which runs on its own thread (SimThread).
+ * This file is the SFML front end that loads the assets, passes the keyboard
+ * to the sim thread and draws the newest world snapshot it published.
+ *
+ * usage: Lab1 [--seed S] [--record FILE] [--trace FILE] [--pack FILE]
+ * the asset pack defaults to assets.cpak, without it the files are decoded
+ * a recorded session replays headless with centipede_headless --replay FILE
+ */
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "AssetPack.h"
+#include "AssetRegistry.h"
+#include "AudioMixer.h"
+#include "GameAssets.h"
+#include "GameWorld.h"
+#include "PerfHud.h"
+#include "PerfStats.h"
+#include "ScoreHud.h"
+#include "SfmlAudio.h"
+#include "SimThread.h"
+#include "SpriteBatch.h"
+#include "StaticLayer.h"
+#include "TextureAtlas.h"
+#include "Trace.h"
+
+using namespace sf;
+
+// atlas region size in world units
+static Vec2 sizeOf(const IntRect& rect)
+{
+    return Vec2(static_cast<float>(rect.width), static_cast<float>(rect.height));
+}
+
+// the prebuilt atlas texture and its regions, straight from the pack
+static bool loadPackedAtlas(const AssetPack& pack, TextureAtlas& atlas)
+{
+    const PackEntry* image = pack.find(ATLAS_NAME);
+    if (image->kind != PACK_IMAGE || image->size != std::uint64_t(image->params[0]) * image->params[1] * 4)
+    {
+        return false;
+    }
+    for (int i = 0; i < pack.getEntryCount(); ++i)
+    {
+        const PackEntry& entry = pack.getEntry(i);
+        if (entry.kind == PACK_REGION)
+        {
+            atlas.addRegion(entry.name, IntRect(entry.params[0], entry.params[1], entry.params[2], entry.params[3]));
+        }
+    }
+    return atlas.loadPacked(static_cast<const Uint8*>(pack.data(*image)), image->params[0], image->params[1]);
+}
+
+int main(int argc, char* argv[]) {
+    auto launchTime = std::chrono::steady_clock::now();
+
+    // a fixed seed gives the same mushroom field and spider every run
+    std::random_device rd;
+    std::uint32_t seed = rd();
+    std::string recordPath;
+    std::string tracePath;
+    std::string packPath = "assets.cpak";
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--seed") == 0)
+        {
+            seed = static_cast<std::uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--record") == 0)
+        {
+            recordPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--trace") == 0)
+        {
+            tracePath = argv[i + 1]; // written when the window closes
+        } else if (std::strcmp(argv[i], "--pack") == 0)
+        {
+            packPath = argv[i + 1];
+        }
+    }
+
+    if (!tracePath.empty())
+    {
+        traceSetThreadName("render");
+        traceEnable(true);
+    }
+
+    // a pack from pack_assets is mapped and used as is, without one the
+    // files decode in the background while the window opens
+    AssetPack pack;
+    bool packed = pack.open(packPath) && pack.find(ATLAS_NAME) && pack.find(FONT_FILE.name)
+        && pack.find(SCORE_DIGITS_NAME);
+    AssetRegistry assets;
+    ImageHandle spriteImages[SPRITE_FILE_COUNT];
+    FontHandle fontHandle;
+    SoundHandle soundHandles[SOUND_FILE_COUNT];
+    if (!packed)
+    {
+        for (int i = 0; i < SPRITE_FILE_COUNT; ++i)
+        {
+            spriteImages[i] = assets.requestImage(SPRITE_FILES[i].path);
+        }
+        fontHandle = assets.requestFont(FONT_FILE.path);
+        for (int i = 0; i < SOUND_FILE_COUNT; ++i)
+        {
+            soundHandles[i] = assets.requestSound(SOUND_FILES[i].path);
+        }
+        assets.startLoading(static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+    }
+
+    VideoMode vm(WIDTH, HEIGHT);
+    RenderWindow window(vm, "Centipede Game");
+
+    // every sprite image is packed into one texture, the upload happens here
+    TextureAtlas atlas;
+    Font packFont;
+    const Font* font = &packFont;
+    SoundBuffer packSounds[SOUND_COUNT];
+    const SoundBuffer* sounds[SOUND_COUNT];
+    if (packed)
+    {
+        // pcm samples go to the sound buffers as they are, a missing one stays silent
+        for (int i = 0; i < SOUND_COUNT; ++i)
+        {
+            const PackEntry* entry = pack.find(SOUND_FILES[i].name);
+            if (entry && entry->kind == PACK_SOUND && entry->size > 0)
+            {
+                packSounds[i].loadFromSamples(static_cast<const Int16*>(pack.data(*entry)), entry->size / sizeof(Int16),
+                                              entry->params[0], entry->params[1]);
+            }
+            sounds[i] = &packSounds[i];
+        }
+
+        // the font reads its file straight out of the mapping
+        const PackEntry* fontEntry = pack.find(FONT_FILE.name);
+        if (!loadPackedAtlas(pack, atlas) || !packFont.loadFromMemory(pack.data(*fontEntry), fontEntry->size))
+        {
+            std::cerr << "could not load the asset pack " << packPath << std::endl;
+            return 1;
+        }
+    } else
+    {
+        // every sprite, the font and every sound is needed, an empty image
+        // would give an entity no size
+        if (assets.wait() > 0)
+        {
+            for (const auto& path : assets.getFailures())
+            {
+                std::cerr << "could not load " << path << std::endl;
+            }
+            return 1;
+        }
+
+        for (int i = 0; i < SPRITE_FILE_COUNT; ++i)
+        {
+            atlas.add(SPRITE_FILES[i].name, assets.getImage(spriteImages[i]));
+        }
+        assets.releaseImages();
+        atlas.add(LASER_NAME, makeLaserImage());
+
+        if (!atlas.build())
+        {
+            std::cerr << "could not build the texture atlas" << std::endl;
+            return 1;
+        }
+        font = &assets.getFont(fontHandle);
+        for (int i = 0; i < SOUND_COUNT; ++i)
+        {
+            sounds[i] = &assets.getSound(soundHandles[i]);
+        }
+    }
+
+    // every voice is made here, game events only start them
+    const int voiceCount = 16;
+    SfmlAudioBackend audioBackend(sounds, voiceCount);
+    AudioMixer mixer(audioBackend, voiceCount);
+    for (int i = 0; i < SOUND_COUNT; ++i)
+    {
+        mixer.setSoundLength(static_cast<SoundId>(i), sounds[i]->getDuration().asSeconds());
+    }
+    const Texture& atlasTexture = atlas.getTexture();
+
+    IntRect backgroundRect = atlas.getRect("background");
+    IntRect mushroom0Rect = atlas.getRect("mushroom0");
+    IntRect mushroom1Rect = atlas.getRect("mushroom1");
+    IntRect starshipRect = atlas.getRect("starship");
+    IntRect spiderRect = atlas.getRect("spider");
+    IntRect cHeadRect = atlas.getRect("centipedeHead");
+    IntRect cBodyRect = atlas.getRect("centipedeBody");
+    IntRect laserRect = atlas.getRect("laser");
+
+    // simulation uses the real sprite sizes
+    WorldConfig config;
+    config.mushroomSize = sizeOf(mushroom0Rect);
+    config.starshipSize = sizeOf(starshipRect);
+    config.spiderSize = sizeOf(spiderRect);
+    config.headSize = sizeOf(cHeadRect);
+    config.bodySize = sizeOf(cBodyRect);
+    config.laserSize = sizeOf(laserRect);
+
+    // the game runs on its own thread at a fixed 120 Hz tick, frames draw
+    // the newest tick it published
+    SimThread sim(config, seed, 120.0f, 8);
+    if (!recordPath.empty() && !sim.record(recordPath))
+    {
+        std::cerr << "could not write input log " << recordPath << std::endl;
+    }
+
+    // start screen sprite
+    Sprite spriteBackground(atlasTexture, backgroundRect);
+    spriteBackground.setPosition(0, 0);
+
+    // mushroom quads, one per tile. damage only changes the atlas rect the
+    // quad samples and only changed tiles are rebuilt
+    const TileLayout tileLayout = sim.latest().world.mushroomLayout;
+    VertexArray mushroomQuads(Quads, tileLayout.cellCount() * 4);
+    std::vector<std::uint8_t> drawnTiles(tileLayout.cellCount(), 0);
+    std::vector<int> changedTiles;
+
+    auto setMushroomQuad = [&](int cell, int health)
+    {
+        Vertex* quad = &mushroomQuads[cell * 4];
+        AABB bounds = tileLayout.cellBounds(cell);
+        if (health == 0)
+        {
+            // collapsed quad draws nothing
+            bounds.width = 0.0f;
+            bounds.height = 0.0f;
+        }
+
+        // mushroom1 once it has been hit
+        const IntRect& rect = health == 1 ? mushroom1Rect : mushroom0Rect;
+        float rectRight = static_cast<float>(rect.left + rect.width);
+        float rectBottom = static_cast<float>(rect.top + rect.height);
+
+        quad[0].position = Vector2f(bounds.left, bounds.top);
+        quad[1].position = Vector2f(bounds.right(), bounds.top);
+        quad[2].position = Vector2f(bounds.right(), bounds.bottom());
+        quad[3].position = Vector2f(bounds.left, bounds.bottom());
+        quad[0].texCoords = Vector2f(rect.left, rect.top);
+        quad[1].texCoords = Vector2f(rectRight, rect.top);
+        quad[2].texCoords = Vector2f(rectRight, rectBottom);
+        quad[3].texCoords = Vector2f(rect.left, rectBottom);
+    };
+
+    // background, black play areas and mushrooms are cached offscreen and
+    // only the tiles that changed are painted again
+    StaticLayer staticLayer;
+    if (!staticLayer.create(WIDTH, HEIGHT))
+    {
+        std::cerr << "could not create the static layer" << std::endl;
+        return 1;
+    }
+    bool staticStarted = sim.latest().world.started;
+
+    auto paintStatic = [&](RenderTarget& target, const FloatRect& area)
+    {
+        if (!staticStarted)
+        {
+            target.draw(spriteBackground); // start screen, only painted whole
+            return;
+        }
+
+        // play areas are black
+        RectangleShape areaShape(Vector2f(area.width, area.height));
+        areaShape.setPosition(area.left, area.top);
+        areaShape.setFillColor(Color::Black);
+        target.draw(areaShape);
+
+        // mushroom tiles under the area, a row of tiles is contiguous
+        int firstColumn = std::max(0, static_cast<int>(std::floor((area.left - tileLayout.origin.x) / tileLayout.tileSize.x)));
+        int lastColumn = std::min(tileLayout.columns - 1, static_cast<int>(std::ceil((area.left + area.width - tileLayout.origin.x) / tileLayout.tileSize.x)) - 1);
+        int firstRow = std::max(0, static_cast<int>(std::floor((area.top - tileLayout.origin.y) / tileLayout.tileSize.y)));
+        int lastRow = std::min(tileLayout.rows - 1, static_cast<int>(std::ceil((area.top + area.height - tileLayout.origin.y) / tileLayout.tileSize.y)) - 1);
+        for (int row = firstRow; row <= lastRow && firstColumn <= lastColumn; ++row)
+        {
+            int first = row * tileLayout.columns + firstColumn;
+            target.draw(&mushroomQuads[first * 4], (lastColumn - firstColumn + 1) * 4, Quads, &atlasTexture);
+        }
+    };
+
+    // moving entities share one atlas, so the batch draws them in one call
+    SpriteBatch batch;
+
+    // top information area, score digits are baked once and the area is
+    // only redrawn when the score or lives change
+    ScoreHud scoreHud;
+    bool scoreReady;
+    if (packed)
+    {
+        // the glyph pixels are followed by their metrics
+        const PackEntry* digits = pack.find(SCORE_DIGITS_NAME);
+        std::uint64_t pixelBytes = std::uint64_t(digits->params[0]) * digits->params[1] * 4;
+        const Uint8* digitPixels = static_cast<const Uint8*>(pack.data(*digits));
+        DigitMetrics metrics;
+        scoreReady = digits->kind == PACK_DIGITS && digits->size == pixelBytes + sizeof(DigitMetrics);
+        if (scoreReady)
+        {
+            std::memcpy(&metrics, digitPixels + pixelBytes, sizeof(DigitMetrics));
+            scoreReady = scoreHud.create(digitPixels, digits->params[0], digits->params[1], metrics,
+                                         atlasTexture, starshipRect);
+        }
+    } else
+    {
+        scoreReady = scoreHud.create(*font, SCORE_CHARACTER_SIZE, atlasTexture, starshipRect);
+    }
+    if (!scoreReady)
+    {
+        std::cerr << "could not create the score display" << std::endl;
+        return 1;
+    }
+    scoreHud.update(sim.latest().world.score, sim.latest().world.lives);
+
+    // frame time graph and phase timings, f3 toggles it
+    PerfHud hud(*font);
+
+    Clock clock;
+    bool firstFrame = true;
+
+    sim.start();
+
+    // main loop
+    while (window.isOpen())
+    {
+        TRACE_ZONE("frame");
+        float frameTime = clock.restart().asSeconds();
+
+        // per phase times for the hud
+        double framePhases[FRAME_PHASE_COUNT] = {};
+
+        // events handlers
+        {
+            TRACE_ZONE("events");
+            PhaseTimer timer(hud.isVisible(), framePhases[FRAME_EVENTS]);
+            Event event;
+            while (window.pollEvent(event))
+            {
+                if (event.type == Event::Closed)
+                {
+                    window.close();
+                }
+                if (event.type == Event::KeyPressed && event.key.code == Keyboard::Escape)
+                {
+                    window.close(); // close on escape
+                }
+                if (event.type == Event::KeyPressed && event.key.code == Keyboard::Enter)
+                {
+                    sim.pressStart(); // start game on enter
+                }
+                // performance overlay on f3
+                if (event.type == Event::KeyPressed && event.key.code == Keyboard::F3)
+                {
+                    hud.toggle();
+                    sim.setPhaseTiming(hud.isVisible());
+                }
+                // shoot laser on space button
+                if (event.type == Event::KeyPressed && event.key.code == Keyboard::Space)
+                {
+                    sim.pressFire();
+                }
+            }
+        }
+
+        // starship movement with left, right, up, down key
+        sim.setHeldKeys(Keyboard::isKeyPressed(Keyboard::Left), Keyboard::isKeyPressed(Keyboard::Right),
+                        Keyboard::isKeyPressed(Keyboard::Up), Keyboard::isKeyPressed(Keyboard::Down));
+
+        // newest tick from the sim thread, stays the same if none came in
+        bool newTick;
+        {
+            TRACE_ZONE("update");
+            PhaseTimer timer(hud.isVisible(), framePhases[FRAME_UPDATE]);
+            newTick = sim.acquire();
+
+            // sounds for everything that happened since the last frame
+            mixer.update(frameTime);
+            GameEvent gameEvent;
+            while (sim.popEvent(gameEvent))
+            {
+                mixer.playEvent(gameEvent);
+            }
+        }
+        const SimFrame& frame = sim.latest();
+        const WorldSnapshot& snapshot = frame.world;
+
+        // how far the frame is past the tick, capped at the tick itself
+        float alpha = std::chrono::duration<float>(std::chrono::steady_clock::now() - frame.time).count() / sim.getTickDelta();
+        alpha = std::min(std::max(alpha, 0.0f), 1.0f);
+
+        scoreHud.update(snapshot.score, snapshot.lives);
+
+        // start screen and game show different static content
+        if (snapshot.started != staticStarted)
+        {
+            staticStarted = snapshot.started;
+            staticLayer.invalidateAll();
+        }
+
+        // rebuild the mushroom tiles that changed, damaged, shot or eaten
+        changedTiles.clear();
+        MushroomField::diff(drawnTiles, snapshot.mushroomTiles, changedTiles);
+        for (int cell : changedTiles)
+        {
+            setMushroomQuad(cell, snapshot.mushroomTiles[cell]);
+            drawnTiles[cell] = snapshot.mushroomTiles[cell];
+
+            // the start screen hides the mushrooms, starting repaints it all
+            if (snapshot.started)
+            {
+                AABB bounds = tileLayout.cellBounds(cell);
+                staticLayer.invalidate(FloatRect(bounds.left, bounds.top, bounds.width, bounds.height));
+            }
+        }
+
+        // rendering
+        int drawCalls = 0;
+        {
+            TRACE_ZONE("render");
+            PhaseTimer timer(hud.isVisible(), framePhases[FRAME_RENDER]);
+            window.clear();
+
+            // start screen or play areas with the mushrooms
+            staticLayer.flush(paintStatic);
+            staticLayer.draw(window);
+            ++drawCalls;
+
+            if (snapshot.started)
+            {
+                batch.clear();
+
+                // draw centipedes
+                for (const auto& segment : snapshot.segments)
+                {
+                    Vec2 position = lerp(segment.previous, segment.position, alpha);
+                    batch.add(atlasTexture, segment.head ? cHeadRect : cBodyRect, position.x, position.y);
+                }
+
+                // draw laser
+                for (const auto& laserView : snapshot.lasers)
+                {
+                    Vec2 position = lerp(laserView.previous, laserView.position, alpha);
+                    batch.add(atlasTexture, laserRect, position.x, position.y);
+                }
+
+                // draw spider
+                if (snapshot.spiderActive)
+                {
+                    Vec2 position = lerp(snapshot.spiderPrevious, snapshot.spider, alpha);
+                    batch.add(atlasTexture, spiderRect, position.x, position.y);
+                }
+
+                // draw starship
+                Vec2 starshipPosition = lerp(snapshot.starshipPrevious, snapshot.starship, alpha);
+                batch.add(atlasTexture, starshipRect, starshipPosition.x, starshipPosition.y);
+
+                batch.draw(window);
+                drawCalls += batch.getDrawCalls();
+
+                // draw score and life icons
+                scoreHud.draw(window);
+                ++drawCalls;
+            }
+
+            hud.draw(window);
+        }
+
+        {
+            TRACE_ZONE("display"); // waits for vsync when the driver does
+            PhaseTimer timer(hud.isVisible(), framePhases[FRAME_DISPLAY]);
+            window.display();
+        }
+
+        if (firstFrame)
+        {
+            firstFrame = false;
+            double launchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - launchTime).count();
+            std::cout << "time to first frame: " << launchSeconds * 1000.0 << " ms";
+            if (packed)
+            {
+                std::cout << " (assets mapped from " << packPath << ")" << std::endl;
+            } else
+            {
+                std::cout << " (assets decoded in " << assets.getLoadSeconds() * 1000.0 << " ms)" << std::endl;
+            }
+        }
+
+        if (hud.isVisible())
+        {
+            HudCounts counts;
+            counts.mushrooms = static_cast<int>(snapshot.mushroomTiles.size())
+                - static_cast<int>(std::count(snapshot.mushroomTiles.begin(), snapshot.mushroomTiles.end(), 0));
+            counts.lasers = static_cast<int>(snapshot.lasers.size());
+            counts.segments = static_cast<int>(snapshot.segments.size());
+            counts.drawCalls = drawCalls;
+            counts.simTicks = sim.getTicks();
+
+            // sim phases only come with a new tick
+            hud.addFrame(frameTime, framePhases, newTick ? &frame.phaseSeconds : nullptr, counts);
+        }
+    }
+
+    if (!sim.stop())
+    {
+        std::cerr << "could not finish input log " << recordPath << std::endl;
+    }
+
+    if (!tracePath.empty() && !traceWriteChrome(tracePath))
+    {
+        std::cerr << "could not write trace " << tracePath << std::endl;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+/**
+ * Author: Leandro Alan Kim
+ * Class: ECE4122 Section A
+ *
+ * Description and Purpose: Builds the asset pack the game maps at startup.
+ * Decodes the sprites, font and sounds the game uses (GameAssets.h), packs
+ * the sprites into the finished atlas, bakes the score digits and writes
+ * everything as raw pixels, glyphs and PCM samples in one file. Run it from
+ * the project folder so the asset paths resolve.
+ *
+ * usage: pack_assets [OUTPUT]   (default assets.cpak)
+ */
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AssetPack.h"
+#include "AssetRegistry.h"
+#include "GameAssets.h"
+#include "ScoreHud.h"
+#include "TextureAtlas.h"
+
+using namespace sf;
+
+static bool readFile(const std::string& path, std::vector<char>& bytes)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static bool addImage(AssetPackWriter& writer, const std::string& name, PackKind kind, const Image& image,
+                     const void* extra = nullptr, std::size_t extraSize = 0)
+{
+    Vector2u size = image.getSize();
+    std::size_t pixelBytes = std::size_t(size.x) * size.y * 4;
+    std::vector<unsigned char> payload(image.getPixelsPtr(), image.getPixelsPtr() + pixelBytes);
+    const unsigned char* extraBytes = static_cast<const unsigned char*>(extra);
+    payload.insert(payload.end(), extraBytes, extraBytes + extraSize);
+
+    std::uint32_t params[4] = {size.x, size.y, 0, 0};
+    return writer.add(name, kind, params, payload.data(), payload.size());
+}
+
+int main(int argc, char* argv[])
+{
+    std::string outputPath = argc > 1 ? argv[1] : "assets.cpak";
+    auto start = std::chrono::steady_clock::now();
+
+    AssetRegistry assets;
+    ImageHandle spriteImages[SPRITE_FILE_COUNT];
+    SoundHandle sounds[SOUND_FILE_COUNT];
+    for (int i = 0; i < SPRITE_FILE_COUNT; ++i)
+    {
+        spriteImages[i] = assets.requestImage(SPRITE_FILES[i].path);
+    }
+    for (int i = 0; i < SOUND_FILE_COUNT; ++i)
+    {
+        sounds[i] = assets.requestSound(SOUND_FILES[i].path);
+    }
+    FontHandle font = assets.requestFont(FONT_FILE.path);
+    assets.startLoading(static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+
+    // a pack with holes would start the game with missing sprites
+    if (assets.wait() > 0)
+    {
+        for (const auto& path : assets.getFailures())
+        {
+            std::cerr << "could not load " << path << std::endl;
+        }
+        return 1;
+    }
+
+    AssetPackWriter writer;
+    bool added = true;
+
+    // the atlas as the game would build it, regions first
+    TextureAtlas atlas;
+    for (int i = 0; i < SPRITE_FILE_COUNT; ++i)
+    {
+        atlas.add(SPRITE_FILES[i].name, assets.getImage(spriteImages[i]));
+    }
+    atlas.add(LASER_NAME, makeLaserImage());
+    Image atlasImage;
+    if (!atlas.pack(atlasImage))
+    {
+        std::cerr << "could not pack the texture atlas" << std::endl;
+        return 1;
+    }
+    for (int i = 0; i < atlas.getRegionCount(); ++i)
+    {
+        IntRect rect = atlas.getRect(atlas.getRegionName(i));
+        std::uint32_t params[4] = {
+            static_cast<std::uint32_t>(rect.left), static_cast<std::uint32_t>(rect.top),
+            static_cast<std::uint32_t>(rect.width), static_cast<std::uint32_t>(rect.height)
+        };
+        added = writer.add(atlas.getRegionName(i), PACK_REGION, params, nullptr, 0) && added;
+    }
+    added = addImage(writer, ATLAS_NAME, PACK_IMAGE, atlasImage) && added;
+
+    // score digits, rendering them needs a gl context but no window
+    Context context;
+    Image digits;
+    DigitMetrics metrics;
+    if (!ScoreHud::bakeDigits(assets.getFont(font), SCORE_CHARACTER_SIZE, digits, metrics))
+    {
+        std::cerr << "could not bake the score digits" << std::endl;
+        return 1;
+    }
+    added = addImage(writer, SCORE_DIGITS_NAME, PACK_DIGITS, digits, &metrics, sizeof(metrics)) && added;
+
+    // the text of the hud still rasterizes at run time, so the font goes in whole
+    std::vector<char> fontBytes;
+    if (!readFile(FONT_FILE.path, fontBytes))
+    {
+        std::cerr << "could not read " << FONT_FILE.path << std::endl;
+        return 1;
+    }
+    std::uint32_t noParams[4] = {};
+    added = writer.add(FONT_FILE.name, PACK_BLOB, noParams, fontBytes.data(), fontBytes.size()) && added;
+
+    for (int i = 0; i < SOUND_FILE_COUNT; ++i)
+    {
+        const SoundBuffer& buffer = assets.getSound(sounds[i]);
+        std::uint32_t params[4] = {buffer.getChannelCount(), buffer.getSampleRate(), 0, 0};
+        added = writer.add(SOUND_FILES[i].name, PACK_SOUND, params, buffer.getSamples(),
+                           static_cast<std::size_t>(buffer.getSampleCount()) * sizeof(Int16)) && added;
+    }
+
+    if (!added || !writer.write(outputPath))
+    {
+        std::cerr << "could not write " << outputPath << std::endl;
+        return 1;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "wrote " << outputPath << " in " << seconds * 1000.0 << " ms" << std::endl;
+    return 0;
+}